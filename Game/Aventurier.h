@@ -15,6 +15,8 @@
 #include "Physics.h"     // Pour collision!
 #include "Objects.h"     // Pour gérer les plateformes!
 #include "Personnages.h" // Pour dessiner le joueur!
+#include "Sprites.h"     // Pour dessiner la porte!
+#include "Minuteries.h"  // Pour animer la marche!
 
 // ==========================================================
 // INFORMATIONS DU JEU (Game information)
@@ -31,29 +33,66 @@ InfoJeu infoAventurier = {
 
 #define AV_GRAVITE 1
 #define AV_FORCE_SAUT 5
-#define AV_MAX_PLATEFORMES 6
+#define AV_VITESSE_CHUTE_MAX 4  // Vitesse de chute max (Max fall speed)
+#define AV_VITESSE_X 2          // Pixels par image (Pixels per frame)
+#define AV_DEPART_X 20          // Position de départ (Start position)
+#define AV_DEPART_Y 48
+#define AV_MAX_PLATEFORMES 6    // Cases de l'anneau (Ring slots)
+#define AV_CAMERA_JOUEUR 64     // La caméra suit après x=64 (Camera follows past x=64)
+#define AV_TOMBE -2             // av_pasPhysique: tombé dans le vide (fell off)
 
 // ==========================================================
 // VARIABLES DU JEU (Game variables)
 // ==========================================================
 
 // Joueur (Player)
-int av_joueurX = 20;
-int av_joueurY = 48;
+int av_joueurX = AV_DEPART_X;
+int av_joueurY = AV_DEPART_Y;
 int av_vitesseY = 0;
 bool av_auSol = true;
 
 // Direction du joueur (Player direction)
 int av_direction = DIR_DROITE;
 
-// Animation
+// Animation: l'image de marche change tous les AV_TOURS_PAS
+// tours, par une minuterie (Minuteries.h)
+// (Walk frame changes every AV_TOURS_PAS ticks, from a timer)
+#define AV_MINU_MARCHE 0
+#define AV_TOURS_PAS 4
 int av_frame = 0;
 bool av_bouge = false;
 
-// Plateformes avec ObjetSimple (Platforms using ObjetSimple)
+// Événements (GameBase.h): un type à nous (Events: a type of our own)
+#define AV_EVT_SAUT (EVT_JEU + 0)
+
+void av_changerPas() {
+  av_frame = 1 - av_frame;
+}
+
+// Niveaux 1-5: plateformes lues directement en Flash, 0 copie
+// (Levels 1-5: platforms read straight from Flash, no copy)
+PmArray<PmPlateforme> av_fixes;
+
+// Niveaux 6+: un ANNEAU de cases ObjetSimple (A RING of ObjetSimple slots)
 // Utilise le champ largeur pour la largeur de plateforme!
+// x est relatif au morceau: x monde = morceau * 32 + x
+// (x is relative to the chunk: world x = chunk * 32 + x)
 ObjetSimple av_plat[AV_MAX_PLATEFORMES];
-int av_nbPlat = 0;
+uint8_t av_platMorceau[AV_MAX_PLATEFORMES];
+uint8_t av_caseSuivante = 0;  // Prochaine case à remplir (Next slot to fill)
+
+// Carte de collision de Objects.h: fixes + anneau, refaite à
+// chaque morceau ajouté ou retiré (64 octets)
+// (Objects.h collision map: fixed + ring, rebuilt on every
+// chunk added or retired)
+CarteCollision av_carte;
+
+// Caméra et monde (Camera and world)
+// Même RAM pour un monde de 1 ou de 16 écrans!
+// (Same RAM for a 1-screen or a 16-screen world!)
+int av_cameraX = 0;
+int av_largeurMonde = 128;
+ProcMonde av_monde;
 
 // Porte (Door)
 int av_porteX = 110;
@@ -68,146 +107,314 @@ int av_etatJeu = ETAT_EN_COURS;
 // DONNÉES NIVEAUX EN PROGMEM (Level data in PROGMEM)
 // ==========================================================
 // Ces données sont stockées en Flash (32KB) pas en RAM (2KB)!
-// Économie: ~72 octets de RAM sauvés!
-// (This data is stored in Flash, not RAM! Saves ~72 bytes!)
-
-// Format: x, y, largeur pour chaque plateforme
-// (Format: x, y, width for each platform)
-
-// Niveau 1 - 5 plateformes + porte
-NIVEAU_PROGMEM(av_niv1_plat, {
-  0, 56, 40,      // Départ (start)
-  45, 46, 30,
-  80, 38, 30,
-  50, 28, 35,
-  95, 18, 33      // Finale
-});
-const uint8_t av_niv1_porte[] PROGMEM = { 110, 3 };
-
-// Niveau 2
-NIVEAU_PROGMEM(av_niv2_plat, {
-  0, 56, 40,
-  35, 46, 25,
-  65, 36, 25,
-  95, 26, 33,
-  60, 16, 35
-});
-const uint8_t av_niv2_porte[] PROGMEM = { 75, 1 };
-
-// Niveau 3
-NIVEAU_PROGMEM(av_niv3_plat, {
-  0, 56, 40,
-  30, 44, 22,
-  60, 54, 22,
-  90, 42, 22,
-  55, 28, 25
-});
-const uint8_t av_niv3_porte[] PROGMEM = { 80, 13 };
-
-// Niveau 4
-NIVEAU_PROGMEM(av_niv4_plat, {
-  0, 56, 40,
-  28, 48, 18,
-  55, 38, 18,
-  82, 48, 18,
-  105, 36, 23
-});
-const uint8_t av_niv4_porte[] PROGMEM = { 115, 21 };
-
-// Niveau 5 - Avec plateforme intermédiaire (with intermediate platform)
-NIVEAU_PROGMEM(av_niv5_plat, {
-  0, 56, 40,      // Départ (start)
-  35, 46, 22,     // Première montée (first climb)
-  65, 36, 22,     // Plateforme intermédiaire (middle platform)
-  95, 46, 22,     // Retour en bas (back down)
-  70, 24, 35      // Plateforme finale (final platform)
-});
-const uint8_t av_niv5_porte[] PROGMEM = { 85, 9 };
+// (This data is stored in Flash, not RAM!)
+//
+// Les niveaux 1-5 sont dessinés en ASCII dans
+// assets/niveaux/aventurier*.txt et convertis par
+// "make assets" en av_nivN_plat / av_nivN_porte.
+// (Levels 1-5 are drawn in ASCII in assets/niveaux and
+// converted by "make assets".)
+#include "NiveauxAventurier.h"
 
 // ==========================================================
 // CRÉER NIVEAU (Create level)
 // ==========================================================
 
-void av_creerNiveau() {
-  // Toujours 5 plateformes (Always 5 platforms)
-  av_nbPlat = 5;
-  
-  // Niveaux 1-5: chargés depuis PROGMEM (hand-crafted)
-  // Niveaux 6+: générés procéduralement (infinite!)
-  
-  if (av_niveau == 1) {
-    obj_chargerPlateformes(av_niv1_plat, av_plat, 5);
-    pm_chargerPorte(av_niv1_porte, &av_porteX, &av_porteY);
+// Niveaux 1-5: lus depuis PROGMEM (hand-crafted) sans copie
+// Retourne false si le niveau est procédural (niveau 6+)
+// (Levels 1-5: read from PROGMEM without copying.
+// Returns false if the level is procedural)
+bool av_chargerNiveauFixe(int niveau, PmArray<PmPlateforme>* plat, int* porteX, int* porteY) {
+  if (niveau == 1) {
+    *plat = pm_tableau(av_niv1_plat);
+    pm_chargerPorte(av_niv1_porte, porteX, porteY);
   }
-  else if (av_niveau == 2) {
-    obj_chargerPlateformes(av_niv2_plat, av_plat, 5);
-    pm_chargerPorte(av_niv2_porte, &av_porteX, &av_porteY);
+  else if (niveau == 2) {
+    *plat = pm_tableau(av_niv2_plat);
+    pm_chargerPorte(av_niv2_porte, porteX, porteY);
   }
-  else if (av_niveau == 3) {
-    obj_chargerPlateformes(av_niv3_plat, av_plat, 5);
-    pm_chargerPorte(av_niv3_porte, &av_porteX, &av_porteY);
+  else if (niveau == 3) {
+    *plat = pm_tableau(av_niv3_plat);
+    pm_chargerPorte(av_niv3_porte, porteX, porteY);
   }
-  else if (av_niveau == 4) {
-    obj_chargerPlateformes(av_niv4_plat, av_plat, 5);
-    pm_chargerPorte(av_niv4_porte, &av_porteX, &av_porteY);
+  else if (niveau == 4) {
+    *plat = pm_tableau(av_niv4_plat);
+    pm_chargerPorte(av_niv4_porte, porteX, porteY);
   }
-  else if (av_niveau == 5) {
-    obj_chargerPlateformes(av_niv5_plat, av_plat, 5);
-    pm_chargerPorte(av_niv5_porte, &av_porteX, &av_porteY);
+  else if (niveau == 5) {
+    *plat = pm_tableau(av_niv5_plat);
+    pm_chargerPorte(av_niv5_porte, porteX, porteY);
   }
   else {
-    // Niveau 6+: génération procédurale avec ObjetSimple!
-    // (Level 6+: procedural generation with ObjetSimple!)
-    int difficulte = proc_calculerDifficulte(av_niveau);
-    
-    // Générer dans tableau temporaire puis copier
-    int tempPlat[5][3];
-    proc_genererPlateformes(av_niveau, tempPlat, 5, difficulte);
-    
-    // Copier vers ObjetSimple
-    for (int i = 0; i < 5; i++) {
-      av_plat[i].x = tempPlat[i][0];
-      av_plat[i].y = tempPlat[i][1];
-      av_plat[i].largeur = tempPlat[i][2];
-      av_plat[i].type = 1;
-      av_plat[i].actif = true;
+    plat->taille = 0;
+    return false;
+  }
+  return true;
+}
+
+// X d'une case dans le monde (World X of a slot)
+inline int av_platX(ObjetSimple* plat, const uint8_t* morceaux, int i) {
+  return (morceaux[i] << PROC_MORCEAU_BITS) + plat[i].x;
+}
+
+// Ranger toutes les plateformes dans la carte, x dans le monde
+// (Store every platform in the map, world x)
+inline void av_construireCarte(CarteCollision* carte, PmArray<PmPlateforme> fixes,
+                               ObjetSimple* plat, const uint8_t* morceaux) {
+  carte_vider(carte);
+  carte_ajouterPlateformes(carte, fixes);
+  for (int i = 0; i < AV_MAX_PLATEFORMES; i++) {
+    if (plat[i].actif) {
+      carte_ajouterPlateforme(carte, av_platX(plat, morceaux, i), plat[i].y, plat[i].largeur);
     }
-    
-    proc_genererPorte(tempPlat, 5, &av_porteX, &av_porteY);
   }
 }
 
+// ----------------------------------------------------------
+// Morceaux à la demande (Chunks on demand)
+// ----------------------------------------------------------
+// Niveaux 6+: un monde de plusieurs écrans. Les morceaux sont
+// fabriqués juste avant d'entrer dans l'écran et retirés dès
+// qu'ils sortent à gauche: 6 cases suffisent, peu importe la
+// longueur du monde.
+// (Levels 6+: a world several screens wide. Chunks are built
+// just before entering the screen and retired as soon as they
+// leave on the left: 6 slots are enough, whatever the world's
+// length.)
+
+// Commencer le niveau av_niveau (Start level av_niveau)
+void av_commencerNiveau() {
+  av_cameraX = 0;
+  av_caseSuivante = 0;
+  for (int i = 0; i < AV_MAX_PLATEFORMES; i++) {
+    av_plat[i].actif = false;
+    av_platMorceau[i] = 0;
+  }
+  
+  bool fixe = av_chargerNiveauFixe(av_niveau, &av_fixes, &av_porteX, &av_porteY);
+  av_construireCarte(&av_carte, av_fixes, av_plat, av_platMorceau);
+  if (fixe) {
+    av_largeurMonde = PROC_ECRAN_LARGEUR;
+    av_monde.suivant = 0;
+    av_monde.nbMorceaux = 0;  // Rien à fabriquer (Nothing to build)
+    return;
+  }
+  
+  int nbMorceaux = proc_mondeNbMorceaux(av_niveau);
+  proc_mondeDebut(&av_monde, av_niveau, nbMorceaux, proc_calculerDifficulte(av_niveau));
+  av_largeurMonde = (nbMorceaux + 1) << PROC_MORCEAU_BITS;
+}
+
+// Retirer les morceaux sortis à gauche (Retire chunks gone off the left)
+void av_retirerMorceaux() {
+  bool retire = false;
+  for (int i = 0; i < AV_MAX_PLATEFORMES; i++) {
+    if (av_plat[i].actif &&
+        av_platX(av_plat, av_platMorceau, i) + av_plat[i].largeur < av_cameraX) {
+      av_plat[i].actif = false;
+      retire = true;
+    }
+  }
+  if (retire) av_construireCarte(&av_carte, av_fixes, av_plat, av_platMorceau);
+}
+
+// Le prochain morceau doit-il exister? (Must the next chunk exist?)
+inline bool av_morceauAttendu() {
+  return !proc_mondeTermine(&av_monde) &&
+         (av_monde.suivant << PROC_MORCEAU_BITS) < av_cameraX + PROC_ECRAN_LARGEUR;
+}
+
+// Une tranche = un morceau (One slice = one chunk)
+// Retourne true s'il manque encore des morceaux devant la caméra
+// (Returns true while chunks are still missing ahead of the camera)
+bool av_trancheNiveau() {
+  if (!av_morceauAttendu()) return false;
+  
+  // Les morceaux sortent dans l'ordre: la case est libre
+  // (Chunks leave in order: the slot is free)
+  int i = av_caseSuivante;
+  if (av_plat[i].actif) return false;
+  
+  proc_mondePas(&av_monde);
+  av_plat[i].x = av_monde.x;
+  av_plat[i].y = av_monde.y;
+  av_plat[i].largeur = av_monde.largeur;
+  av_plat[i].type = 1;
+  av_plat[i].actif = true;
+  av_platMorceau[i] = av_monde.suivant - 1;
+  av_construireCarte(&av_carte, av_fixes, av_plat, av_platMorceau);
+  
+  av_caseSuivante++;
+  if (av_caseSuivante >= AV_MAX_PLATEFORMES) av_caseSuivante = 0;
+  
+  if (proc_mondeTermine(&av_monde)) {
+    proc_mondePorte(&av_monde, &av_porteX, &av_porteY);
+  }
+  return av_morceauAttendu();
+}
+
+// Une fois par image: au plus UN morceau fabriqué
+// (Once per frame: at most ONE chunk built)
+void av_avancerMonde() {
+  av_retirerMorceaux();
+  av_trancheNiveau();
+}
+
+// Créer le niveau tout de suite (Create the level right now)
+void av_creerNiveau() {
+  av_commencerNiveau();
+  while (av_trancheNiveau()) { }
+}
+
 // ==========================================================
 // PHYSIQUE (Physics)
 // ==========================================================
+// av_pasControles et av_pasPhysique sont la VRAIE physique du
+// jeu, sans variable globale. Le validateur (tools/validator)
+// les rejoue pour prouver qu'un niveau est gagnable.
+// (av_pasControles and av_pasPhysique are the REAL game physics,
+// with no globals. The validator (tools/validator) replays them
+// to prove a level can be won.)
+
+// Appliquer les contrôles (Apply controls)
+// dx: -1 gauche, 0 rien, 1 droite - saut: seulement si au sol!
+// xMin/xMax: bord gauche de la caméra et bout du monde
+// (xMin/xMax: camera's left edge and the end of the world)
+inline void av_pasControles(int* x, int* vy, int dx, bool saut, int xMin, int xMax) {
+  *x = *x + dx * AV_VITESSE_X;
+  
+  // Limites (Limits)
+  if (*x < xMin) *x = xMin;
+  if (*x > xMax) *x = xMax;
+  
+  if (saut) {
+    *vy = -AV_FORCE_SAUT;
+  }
+}
 
-bool av_surPlateforme() {
-  int piedY = av_joueurY + 6;
+// Plateforme sous les pieds, x en coordonnées du monde
+// Numéros: d'abord les plateformes fixes, puis les cases.
+// La carte dit d'abord s'il peut y en avoir une: en l'air,
+// quelques bits lus et aucune plateforme parcourue.
+// (Platform underfoot, x in world coordinates.
+// Numbers: fixed platforms first, then the ring slots.
+// The map first says whether there can be one: in the air, a
+// few bits read and no platform walked.)
+inline int av_surPlateforme(PmArray<PmPlateforme> fixes, ObjetSimple* plat,
+                            const uint8_t* morceaux, const CarteCollision* carte,
+                            int x, int piedY, int vitesseY) {
+  if (vitesseY < 0 || !carte_solPossible(carte, x, piedY)) return -1;
   
-  // Utilise obj_surPlateforme de Objects.h!
-  return obj_surPlateforme(av_plat, av_nbPlat, av_joueurX, piedY, av_vitesseY) >= 0;
+  // Lue en Flash (Read from Flash)
+  int sol = obj_surPlateformeFlash(fixes, x, piedY, vitesseY);
+  if (sol >= 0) return sol;
+  
+  for (int i = 0; i < AV_MAX_PLATEFORMES; i++) {
+    // Utilise obj_surPlateforme de Objects.h, case par case!
+    int decalage = morceaux[i] << PROC_MORCEAU_BITS;
+    if (obj_surPlateforme(&plat[i], 1, x - decalage, piedY, vitesseY) == 0) {
+      return fixes.taille + i;
+    }
+  }
+  return -1;
 }
 
-void av_physique() {
-  av_auSol = av_surPlateforme();
+// Appliquer gravité et plateformes (Apply gravity and platforms)
+// Retourne la case sous les pieds, -1 en l'air, AV_TOMBE si tombé
+// (Returns the slot underfoot, -1 in the air, AV_TOMBE if fallen)
+inline int av_pasPhysique(int* x, int* y, int* vy, PmArray<PmPlateforme> fixes,
+                          ObjetSimple* plat, const uint8_t* morceaux,
+                          const CarteCollision* carte) {
+  int sol = av_surPlateforme(fixes, plat, morceaux, carte, *x, *y + 6, *vy);
   
-  if (av_auSol) {
-    av_vitesseY = 0;
+  if (sol >= 0) {
+    *vy = 0;
   } else {
-    av_vitesseY = av_vitesseY + AV_GRAVITE;
-    if (av_vitesseY > 4) av_vitesseY = 4;
+    *vy = *vy + AV_GRAVITE;
+    if (*vy > AV_VITESSE_CHUTE_MAX) *vy = AV_VITESSE_CHUTE_MAX;
   }
   
-  av_joueurY = av_joueurY + av_vitesseY;
+  *y = *y + *vy;
   
-  // Tombé? Reset! (Fell? Reset!)
-  if (av_joueurY > 64) {
-    av_joueurX = 20;
-    av_joueurY = 48;
+  // Tombé? (Fell?)
+  if (*y > 64) return AV_TOMBE;
+  return sol;
+}
+
+// Le joueur touche la porte? (Player touches door?)
+inline bool av_toucheAPorte(int x, int y, int porteX, int porteY) {
+  return phys_touchePoint(x, y, porteX, porteY + 6, 10);
+}
+
+// Réapparaître sur la première plateforme visible
+// (Respawn on the first visible platform)
+void av_reapparaitre() {
+  // Niveaux 1-5: la plateforme de départ (Levels 1-5: the start platform)
+  if (av_fixes.taille > 0) {
+    PmStruct<PmPlateforme> depart = av_fixes.ligne(0);
+    av_joueurX = depart.lire(&PmPlateforme::x) + depart.lire(&PmPlateforme::largeur) / 2;
+    av_joueurY = depart.lire(&PmPlateforme::y) - 8;
     av_vitesseY = 0;
+    return;
+  }
+  
+  int meilleur = -1;
+  int meilleurX = 0;
+  for (int i = 0; i < AV_MAX_PLATEFORMES; i++) {
+    int px = av_platX(av_plat, av_platMorceau, i);
+    if (av_plat[i].actif && px >= av_cameraX && (meilleur < 0 || px < meilleurX)) {
+      meilleur = i;
+      meilleurX = px;
+    }
+  }
+  
+  // Aucune devant la caméra (morceau vide, fin du monde): la
+  // plus proche à gauche (None ahead of the camera - empty
+  // chunk, end of the world: the nearest one on the left)
+  if (meilleur < 0) {
+    for (int i = 0; i < AV_MAX_PLATEFORMES; i++) {
+      int px = av_platX(av_plat, av_platMorceau, i);
+      if (av_plat[i].actif && (meilleur < 0 || px > meilleurX)) {
+        meilleur = i;
+        meilleurX = px;
+      }
+    }
+  }
+  
+  // Plus rien du tout: le départ, à l'écran (Nothing at all: the start, on screen)
+  if (meilleur < 0) {
+    av_joueurX = av_cameraX + AV_DEPART_X;
+    av_joueurY = AV_DEPART_Y;
+    av_vitesseY = 0;
+    return;
+  }
+  
+  av_joueurX = meilleurX + av_plat[meilleur].largeur / 2;
+  av_joueurY = av_plat[meilleur].y - 8;
+  av_vitesseY = 0;
+}
+
+// La caméra suit le joueur, seulement vers la droite
+// (The camera follows the player, only to the right)
+void av_suivreCamera() {
+  int cible = av_joueurX - AV_CAMERA_JOUEUR;
+  if (cible > av_cameraX) av_cameraX = cible;
+  if (av_cameraX > av_largeurMonde - PROC_ECRAN_LARGEUR) {
+    av_cameraX = av_largeurMonde - PROC_ECRAN_LARGEUR;
   }
 }
 
+void av_physique() {
+  int sol = av_pasPhysique(&av_joueurX, &av_joueurY, &av_vitesseY,
+                           av_fixes, av_plat, av_platMorceau, &av_carte);
+  if (sol == AV_TOMBE) {
+    av_reapparaitre();
+    sol = -1;
+  }
+  av_auSol = sol >= 0;
+  av_suivreCamera();
+}
+
 // ==========================================================
 // CONTRÔLES (Controls)
 // ==========================================================
@@ -216,27 +423,25 @@ void av_controles() {
   lireJoystick();
   av_bouge = false;
   
+  int dx = 0;
   if (joystickGauche()) {
-    av_joueurX = av_joueurX - 2;
-    av_bouge = true;
-    av_frame = 1 - av_frame;
+    dx = -1;
     av_direction = DIR_GAUCHE;
   }
   if (joystickDroite()) {
-    av_joueurX = av_joueurX + 2;
-    av_bouge = true;
-    av_frame = 1 - av_frame;
+    dx = 1;
     av_direction = DIR_DROITE;
   }
-  
-  // Limites écran (Screen limits)
-  if (av_joueurX < 5) av_joueurX = 5;
-  if (av_joueurX > 123) av_joueurX = 123;
+  if (dx != 0) {
+    av_bouge = true;
+  }
   
   // Sauter (Jump)
-  if (boutonJustePresse() && av_auSol) {
-    av_vitesseY = -AV_FORCE_SAUT;
-    melodieTir();
+  bool saut = boutonJustePresse() && av_auSol;
+  av_pasControles(&av_joueurX, &av_vitesseY, dx, saut,
+                  av_cameraX + 5, av_largeurMonde - 5);
+  if (saut) {
+    evt_poster(AV_EVT_SAUT);
   }
 }
 
@@ -246,25 +451,53 @@ void av_controles() {
 // Utilise Personnages.h pour dessiner le joueur!
 // (Uses Personnages.h to draw the player!)
 
+// Une plateforme, x dans le monde, coupée au bord gauche
+// (One platform, world x, clipped at the left edge)
+void av_dessinerPlateforme(int x, int y, int largeur) {
+  x = x - av_cameraX;
+  if (x < 0) {
+    largeur = largeur + x;
+    x = 0;
+  }
+  if (largeur > 0 && x < PROC_ECRAN_LARGEUR) {
+    dessinerRectangle(x, y, largeur, 4);
+  }
+}
+
 // Dessiner le contenu du jeu (Draw game content) - appelé dans la boucle page
 void av_dessinerContenu() {
+  // Étoiles du fond: moitié moins vite que la caméra (parallaxe)
+  // (Background stars: half the camera's speed - parallax)
+  proc_fondPage(tamponPage(), numeroPage(), proc_bruitGraine(av_niveau, PROC_FLUX_JEU),
+                av_cameraX >> 1, 0, 40, 10, 63);
+  
   // Score (Score)
   ecrireTexteNombre(0, 0, "Niv ", av_niveau, 1);
   
+  // Plateformes fixes, lues en Flash (Fixed platforms, read from Flash)
+  for (uint16_t i = 0; i < av_fixes.taille; i++) {
+    PmStruct<PmPlateforme> p = av_fixes.ligne(i);
+    av_dessinerPlateforme(p.lire(&PmPlateforme::x), p.lire(&PmPlateforme::y),
+                          p.lire(&PmPlateforme::largeur));
+  }
+  
   // Plateformes avec ObjetSimple (Platforms with ObjetSimple)
-  for (int i = 0; i < av_nbPlat; i++) {
+  for (int i = 0; i < AV_MAX_PLATEFORMES; i++) {
     if (av_plat[i].actif) {
-      dessinerRectangle(av_plat[i].x, av_plat[i].y, av_plat[i].largeur, 4);
+      av_dessinerPlateforme(av_platX(av_plat, av_platMorceau, i), av_plat[i].y, av_plat[i].largeur);
     }
   }
   
-  // Porte (Door)
-  dessinerContour(av_porteX - 4, av_porteY, 8, 14);
-  dessinerCercle(av_porteX + 1, av_porteY + 7, 1);
+  // Porte: seulement quand le dernier morceau existe et qu'on la voit
+  // (Door: only once the last chunk exists and it is on screen)
+  int porteX = av_porteX - av_cameraX;
+  if (proc_mondeTermine(&av_monde) && porteX >= 4 && porteX < PROC_ECRAN_LARGEUR) {
+    dessinerSprite(porteX - 4, av_porteY, &spr_porte, 0);
+  }
   
   // Joueur - utilise Personnages.h vue plateforme!
   // (Player - uses Personnages.h platform view!)
-  pers_dessinerPlateforme(av_joueurX, av_joueurY, personnageActuel, 
+  pers_dessinerPlateforme(av_joueurX - av_cameraX, av_joueurY, personnageActuel, 
                           av_direction, av_bouge ? av_frame : 0);
 }
 
@@ -280,8 +513,8 @@ void av_dessiner() {
 // Simplifié avec Physics.h!
 
 bool av_touchePorte() {
-  // Le joueur touche la porte? (Player touches door?)
-  return phys_touchePoint(av_joueurX, av_joueurY, av_porteX, av_porteY + 6, 10);
+  return proc_mondeTermine(&av_monde) &&
+         av_toucheAPorte(av_joueurX, av_joueurY, av_porteX, av_porteY);
 }
 
 void av_niveauTermine() {
@@ -289,7 +522,6 @@ void av_niveauTermine() {
   DESSINER_ECRAN {
     ecrireTexte(20, 20, "BRAVO!", 2);
   }
-  delay(1500);
   
   // Niveau suivant - maintenant infini!
   // (Next level - now infinite!)
@@ -297,11 +529,26 @@ void av_niveauTermine() {
   // Plus de limite! Les niveaux 5+ sont générés automatiquement
   // (No more limit! Levels 5+ are generated automatically)
   
+  // Fabriqué PENDANT que "BRAVO!" est affiché: prêt tout de suite!
+  // (Built WHILE "BRAVO!" is shown: ready right away!)
+  av_commencerNiveau();
+  attendreEnTravaillant(1500, av_trancheNiveau);
+  
   // Reset joueur (Reset player)
-  av_joueurX = 20;
-  av_joueurY = 48;
+  av_joueurX = AV_DEPART_X;
+  av_joueurY = AV_DEPART_Y;
   av_vitesseY = 0;
-  av_creerNiveau();
+}
+
+// ==========================================================
+// ÉVÉNEMENTS (Events) - traités par Game.ino après le dessin
+// (Handled by Game.ino after drawing)
+// ==========================================================
+
+void av_traiterEvenement(const Evenement* e) {
+  if (e->type == AV_EVT_SAUT) {
+    melodieTir();
+  }
 }
 
 // ==========================================================
@@ -313,14 +560,14 @@ void av_setupJeu() {
 }
 
 void av_resetJeu() {
-  av_joueurX = 20;
-  av_joueurY = 48;
+  av_joueurX = AV_DEPART_X;
+  av_joueurY = AV_DEPART_Y;
   av_vitesseY = 0;
   av_direction = DIR_DROITE;
   av_niveau = 1;
   av_etoiles = 0;
-  av_nbPlat = 0;
   av_etatJeu = ETAT_EN_COURS;
+  minu_lancer(&minu_jeu, AV_MINU_MARCHE, AV_TOURS_PAS, AV_TOURS_PAS, av_changerPas);
   av_creerNiveau();  // Creer le niveau immediatement!
 }
 
@@ -332,13 +579,15 @@ void av_loopJeu() {
   // TEST 4 - COMPLET avec porte
   av_controles();
   av_physique();
+  av_avancerMonde();
   
+  // "BRAVO!" reste affiché pendant l'attente (stays on screen during the wait)
   if (av_touchePorte()) {
     av_niveauTermine();
+    return;
   }
   
   av_dessiner();
-  delay(30);
 }
 
 #endif
@@ -25,6 +25,13 @@ InfoJeu infoBreakout = { "Breakout", "Casse-briques!" };
 #define BR_MAX_BLOCS 24         // Max blocks (6 cols × 4 rows)
 #define BR_VIES_DEBUT 3         // Starting lives
 
+// Valeurs de EVT_TOUCHE: ce que la balle a touché
+// (EVT_TOUCHE values: what the ball hit)
+#define BR_TOUCHE_BLOC 0
+#define BR_TOUCHE_RAQUETTE 1
+#define BR_TOUCHE_MUR 2
+#define BR_TOUCHE_FOND 3        // Balle perdue (Ball lost)
+
 // ==========================================================
 // VARIABLES DU JEU (Game variables)
 // ==========================================================
@@ -38,6 +45,7 @@ int br_niveau = 1;
 // Raquette (Paddle)
 int br_raquetteX = 54;  // Center: (128 - 20) / 2 = 54
 int br_raquetteY = 58;
+int br_raquetteDX = 0;  // Déplacement de ce tour (This tick's move)
 
 // Balle (Ball)
 int br_balleX = 64;
@@ -90,6 +98,7 @@ void br_resetJeu() {
   br_vies = BR_VIES_DEBUT;
   br_niveau = 1;
   br_raquetteX = 54;
+  br_raquetteDX = 0;
   br_balleX = 64;
   br_balleY = 50;
   br_balleVX = 2;
@@ -108,6 +117,7 @@ int br_getEtatJeu() {
 
 void br_controles() {
   lireJoystick();
+  int avant = br_raquetteX;
   
   // Déplacer la raquette (Move paddle)
   if (joystickGauche()) {
@@ -120,6 +130,7 @@ void br_controles() {
       br_raquetteX = 128 - BR_LARGEUR_RAQUETTE;
     }
   }
+  br_raquetteDX = br_raquetteX - avant;
   
   // Lancer la balle (Launch ball)
   if (br_balleCollee && boutonJustePresse()) {
@@ -128,6 +139,92 @@ void br_controles() {
   }
 }
 
+// ==========================================================
+// COLLISION AVEC LES BLOCS (Block collision)
+// ==========================================================
+// La balle suit tout son trajet avec phys_balayerBoite: même
+// très rapide, elle ne traverse ni une brique ni la raquette,
+// et elle rebondit sur la face touchée.
+// (The ball follows its whole move with phys_balayerBoite: even
+// very fast, it never goes through a brick or the paddle, and
+// it bounces off the face it hit.)
+
+#define BR_AUCUN -1      // Rien sur le trajet (Nothing on the path)
+#define BR_RAQUETTE -2   // La raquette (The paddle)
+
+// Le premier obstacle sur le trajet de la balle
+// Retourne un numéro de bloc, BR_RAQUETTE ou BR_AUCUN
+// (The first obstacle on the ball's path. Returns a block
+// number, BR_RAQUETTE or BR_AUCUN)
+int br_premierObstacle(Impact* impact) {
+  int obstacle = BR_AUCUN;
+  Impact essai;
+  
+  for (int i = 0; i < BR_MAX_BLOCS; i++) {
+    if (br_blocs[i][2] == 1 &&  // Si bloc actif (If block active)
+        phys_balayerBoite(br_balleX, br_balleY, BR_TAILLE_BALLE, BR_TAILLE_BALLE,
+                          br_balleVX, br_balleVY, br_blocs[i][0], br_blocs[i][1], 18, 5, &essai) &&
+        (obstacle == BR_AUCUN || essai.temps < impact->temps)) {
+      *impact = essai;
+      obstacle = i;
+    }
+  }
+  
+  // La raquette a bougé ce tour: on balaie la balle vue DEPUIS la
+  // raquette (trajet moins celui de la raquette, départ à
+  // l'ancienne place). Sinon une raquette qui fonce sur la balle
+  // passe au travers. (The paddle moved this tick: sweep the ball
+  // as seen FROM the paddle - its move minus the paddle's, from
+  // the old spot. Otherwise a paddle rushing into the ball goes
+  // through it.)
+  if (phys_balayerBoite(br_balleX, br_balleY, BR_TAILLE_BALLE, BR_TAILLE_BALLE,
+                        br_balleVX - br_raquetteDX, br_balleVY,
+                        br_raquetteX - br_raquetteDX, br_raquetteY,
+                        BR_LARGEUR_RAQUETTE, BR_HAUTEUR_RAQUETTE, &essai) &&
+      (obstacle == BR_AUCUN || essai.temps < impact->temps)) {
+    *impact = essai;
+    obstacle = BR_RAQUETTE;
+  }
+  return obstacle;
+}
+
+// Détruire un bloc touché (Destroy a block that was hit)
+void br_casserBloc(int i) {
+  br_blocs[i][2] = 0;
+  br_blocsRestants--;
+  evt_poster(EVT_TOUCHE, BR_TOUCHE_BLOC);
+  evt_poster(EVT_POINTS, 10);
+}
+
+// Rebond sur le dessus de la raquette: l'angle dépend de
+// l'endroit touché (Bounce on top of the paddle: the angle
+// depends on where it hit)
+void br_rebondRaquette(const Impact* impact) {
+  evt_poster(EVT_TOUCHE, BR_TOUCHE_RAQUETTE);
+  
+  // La raquette a fini son trajet: sortir la balle par la face
+  // touchée (The paddle finished its move: push the ball out
+  // through the face it hit)
+  if (impact->normaleX < 0) br_balleX = br_raquetteX - BR_TAILLE_BALLE;
+  if (impact->normaleX > 0) br_balleX = br_raquetteX + BR_LARGEUR_RAQUETTE;
+  if (impact->normaleY < 0) br_balleY = br_raquetteY - BR_TAILLE_BALLE;
+  
+  if (impact->normaleY >= 0) {
+    // Touchée sur le côté: partir plus vite que la raquette
+    // (Hit on the side: leave faster than the paddle)
+    if (impact->normaleX * br_balleVX <= impact->normaleX * br_raquetteDX) {
+      br_balleVX = br_raquetteDX + impact->normaleX;
+    }
+    return;
+  }
+  
+  // Changer angle selon où on touche la raquette (Change angle based on hit position)
+  int centreRaquette = br_raquetteX + BR_LARGEUR_RAQUETTE / 2;
+  int offset = br_balleX - centreRaquette;
+  br_balleVX = offset / 4;  // -5 to +5
+  if (br_balleVX == 0) br_balleVX = 1;  // Toujours un peu de mouvement X
+}
+
 // ==========================================================
 // PHYSIQUE DE LA BALLE (Ball physics)
 // ==========================================================
@@ -140,37 +237,38 @@ void br_bougerBalle() {
     return;
   }
   
-  // Déplacer la balle (Move ball)
-  br_balleX += br_balleVX;
-  br_balleY += br_balleVY;
+  // Déplacer la balle jusqu'au premier obstacle (Move ball up to the first obstacle)
+  Impact impact;
+  int obstacle = br_premierObstacle(&impact);
+  if (obstacle == BR_AUCUN) {
+    br_balleX += br_balleVX;
+    br_balleY += br_balleVY;
+  } else {
+    phys_resoudreImpact(&br_balleX, &br_balleY, &br_balleVX, &br_balleVY, &impact);
+    if (obstacle == BR_RAQUETTE) br_rebondRaquette(&impact);
+    else br_casserBloc(obstacle);
+  }
   
   // Rebond sur les murs gauche/droite (Bounce on left/right walls)
   if (br_balleX <= 0 || br_balleX >= 128 - BR_TAILLE_BALLE) {
     br_balleVX = -br_balleVX;
     br_balleX = phys_clamp(br_balleX, 0, 128 - BR_TAILLE_BALLE);
-    melodieMenuSelect();
+    evt_poster(EVT_TOUCHE, BR_TOUCHE_MUR);
+  }
+  
+  // Coincée entre le mur et la raquette: par-dessus la raquette
+  // (Squeezed between the wall and the paddle: over the paddle)
+  if (br_balleX < br_raquetteX + BR_LARGEUR_RAQUETTE && br_raquetteX < br_balleX + BR_TAILLE_BALLE &&
+      br_balleY < br_raquetteY + BR_HAUTEUR_RAQUETTE && br_raquetteY < br_balleY + BR_TAILLE_BALLE) {
+    br_balleY = br_raquetteY - BR_TAILLE_BALLE;
+    if (br_balleVY > 0) br_balleVY = -br_balleVY;
   }
   
   // Rebond sur le mur du haut (Bounce on top wall)
   if (br_balleY <= 10) {  // Score bar at top
     br_balleVY = -br_balleVY;
     br_balleY = 10;
-    melodieMenuSelect();
-  }
-  
-  // Rebond sur la raquette (Bounce on paddle)
-  if (phys_toucheBoite(br_balleX, br_balleY, BR_TAILLE_BALLE, BR_TAILLE_BALLE,
-                       br_raquetteX, br_raquetteY, BR_LARGEUR_RAQUETTE, BR_HAUTEUR_RAQUETTE)) {
-    br_balleVY = -br_balleVY;
-    br_balleY = br_raquetteY - BR_TAILLE_BALLE - 1;
-    
-    // Changer angle selon où on touche la raquette (Change angle based on hit position)
-    int centreRaquette = br_raquetteX + BR_LARGEUR_RAQUETTE / 2;
-    int offset = br_balleX - centreRaquette;
-    br_balleVX = offset / 4;  // -5 to +5
-    if (br_balleVX == 0) br_balleVX = 1;  // Toujours un peu de mouvement X
-    
-    melodieRecharge();
+    evt_poster(EVT_TOUCHE, BR_TOUCHE_MUR);
   }
   
   // Balle tombée en bas (Ball fell down)
@@ -178,9 +276,9 @@ void br_bougerBalle() {
     br_vies--;
     if (br_vies <= 0) {
       br_etatJeu = ETAT_TERMINE;
-      melodieGameOver();
+      evt_poster(EVT_FIN);
     } else {
-      melodiePasDeMunitions();
+      evt_poster(EVT_TOUCHE, BR_TOUCHE_FOND);
       br_balleCollee = true;
       br_balleX = 64;
       br_balleY = 50;
@@ -191,48 +289,47 @@ void br_bougerBalle() {
 }
 
 // ==========================================================
-// COLLISION AVEC LES BLOCS (Block collision)
+// NIVEAU SUIVANT (Next level)
 // ==========================================================
 
-void br_verifierBlocsCollision() {
-  if (br_balleCollee) return;
+void br_verifierNiveauTermine() {
+  if (br_blocsRestants > 0) return;
   
-  for (int i = 0; i < BR_MAX_BLOCS; i++) {
-    if (br_blocs[i][2] == 1) {  // Si bloc actif (If block active)
-      int blocX = br_blocs[i][0];
-      int blocY = br_blocs[i][1];
-      
-      if (phys_toucheBoite(br_balleX, br_balleY, BR_TAILLE_BALLE, BR_TAILLE_BALLE,
-                           blocX, blocY, 18, 5)) {
-        // Détruire le bloc (Destroy block)
-        br_blocs[i][2] = 0;
-        br_blocsRestants--;
-        br_score += 10;
-        melodieMonstreTouche();
-        
-        // Rebond (Bounce)
-        br_balleVY = -br_balleVY;
-        
-        // Vérifier si niveau terminé (Check if level complete)
-        if (br_blocsRestants == 0) {
-          br_niveau++;
-          br_score += 100;
-          melodieNiveauSup();
-          delay(1000);
-          br_creerBlocs();
-          br_balleCollee = true;
-          br_balleX = 64;
-          br_balleY = 50;
-          
-          // Augmenter vitesse (Increase speed)
-          if (br_balleVX > 0) br_balleVX++;
-          else br_balleVX--;
-          if (br_balleVY > 0) br_balleVY++;
-          else br_balleVY--;
-        }
-        break;  // Un seul bloc à la fois (One block at a time)
-      }
-    }
+  br_niveau++;
+  evt_poster(EVT_POINTS, 100);
+  evt_poster(EVT_NIVEAU, br_niveau);
+  br_creerBlocs();
+  br_balleCollee = true;
+  br_balleX = 64;
+  br_balleY = 50;
+  
+  // Augmenter vitesse (Increase speed)
+  if (br_balleVX > 0) br_balleVX++;
+  else br_balleVX--;
+  if (br_balleVY > 0) br_balleVY++;
+  else br_balleVY--;
+}
+
+// ==========================================================
+// ÉVÉNEMENTS (Events) - traités par Game.ino après le dessin
+// (Handled by Game.ino after drawing)
+// ==========================================================
+
+void br_traiterEvenement(const Evenement* e) {
+  if (e->type == EVT_POINTS) {
+    br_score += e->valeur;
+  } else if (e->type == EVT_TOUCHE) {
+    if (e->valeur == BR_TOUCHE_BLOC) melodieMonstreTouche();
+    else if (e->valeur == BR_TOUCHE_RAQUETTE) melodieRecharge();
+    else if (e->valeur == BR_TOUCHE_MUR) melodieMenuSelect();
+    else melodiePasDeMunitions();
+  } else if (e->type == EVT_NIVEAU) {
+    // Le nouveau niveau est déjà dessiné, balle collée
+    // (The new level is already drawn, ball stuck)
+    melodieNiveauSup();
+    patienter(1000);
+  } else if (e->type == EVT_FIN) {
+    melodieGameOver();
   }
 }
 
@@ -300,9 +397,8 @@ void br_loopJeu() {
   // Jeu en cours (Game running)
   br_controles();
   br_bougerBalle();
-  br_verifierBlocsCollision();
+  br_verifierNiveauTermine();
   br_dessiner();
-  delay(30);
 }
 
 #endif
@@ -13,6 +13,8 @@
 
 #include <Wire.h>
 #include <U8g2lib.h>
+#include "ProgMem.h"
+#include "Physics.h"
 
 // Configuration de l'écran OLED (OLED screen configuration)
 #define LARGEUR_ECRAN 128
@@ -177,4 +179,213 @@ inline void afficherAppuieContinuer() {
 #define DESSINER_ECRAN \
   for (bool _p = (ecran.firstPage(), true); _p || ecran.nextPage(); _p = false)
 
+// ==========================================================
+// ACCÈS À LA PAGE (Page access)
+// ==========================================================
+// Dans DESSINER_ECRAN, l'écran est dessiné 8 lignes à la fois.
+// Le buffer de la page: 128 octets, un par colonne, bit 0 =
+// ligne du haut de la page. Pour écrire des pixels très vite
+// (fonds de Procedural.h).
+// (Inside DESSINER_ECRAN the screen is drawn 8 rows at a time.
+// The page buffer: 128 bytes, one per column, bit 0 = top row
+// of the page. For writing pixels very fast (Procedural.h
+// backgrounds).)
+
+inline uint8_t* tamponPage() {
+  return ecran.getBufferPtr();
+}
+
+// Numéro de la page en cours: 0 (haut) à 7 (bas)
+// (Current page number: 0 (top) to 7 (bottom))
+inline uint8_t numeroPage() {
+  return ecran.getBufferCurrTileRow();
+}
+
+// ==========================================================
+// SPRITES (Sprites)
+// ==========================================================
+// Images 1 bit en PROGMEM, déjà au format de la page (fichier
+// Sprites.h fait par "make assets"): 1 octet = une colonne de
+// 8 pixels. Pas de drawPixel: chaque colonne est UN octet
+// décalé puis ajouté au tampon de la page. Avec un masque,
+// les pixels opaques effacent d'abord le fond.
+// (1-bit pictures in PROGMEM, already in page format - Sprites.h
+// made by "make assets": 1 byte = a column of 8 pixels. No
+// drawPixel: each column is ONE byte shifted then added to the
+// page buffer. With a mask, opaque pixels erase the background
+// first.)
+//
+// Usage:
+//   #include "Sprites.h"
+//   DESSINER_ECRAN {
+//     dessinerSprite(x, y, &spr_porte, 0);
+//   }
+
+struct Sprite {
+  const uint8_t* dessin;   // [image][page][colonne] (frame, page, column)
+  const uint8_t* masque;   // Même forme, ou nullptr = OR seulement (OR only)
+  uint8_t largeur;
+  uint8_t hauteur;
+  uint8_t pages;
+  uint8_t images;
+};
+
+// Dessiner un sprite dans le tampon d'une page (Draw into one page buffer)
+// Une ligne du sprite à y tombe dans la page y/8. Pour un y
+// quelconque, chaque page du sprite est à cheval sur deux pages
+// de l'écran: octet * 2^(y%8) donne les deux moitiés d'un coup
+// (octet bas = cette page, octet haut = la suivante), avec une
+// seule multiplication matérielle au lieu d'une boucle de décalage.
+// (For any y, each sprite page straddles two screen pages:
+// byte * 2^(y%8) gives both halves at once - low byte = this
+// page, high byte = the next - with one hardware multiply
+// instead of a shift loop.)
+void dessinerSpritePage(uint8_t* tampon, uint8_t page, int x, int y,
+                        const Sprite* sprite, uint8_t image) {
+  PmStruct<Sprite> s = { sprite };
+  uint8_t largeur = s.lire(&Sprite::largeur);
+  uint8_t pages = s.lire(&Sprite::pages);
+  
+  // Haut du sprite par rapport à la page: dy = 8 * q + r
+  // (Sprite top relative to the page)
+  int dy = y - page * 8;
+  if (dy >= 8 || dy + s.lire(&Sprite::hauteur) <= 0) return;
+  int q = dy >> 3;
+  uint8_t r = dy & 7;
+  
+  // Colonnes visibles (Visible columns)
+  int debut = x < 0 ? -x : 0;
+  int fin = x + largeur > LARGEUR_ECRAN ? LARGEUR_ECRAN - x : largeur;
+  if (debut >= fin) return;
+  
+  uint16_t taille = (uint16_t)pages * largeur;
+  const uint8_t* dessin = s.lire(&Sprite::dessin) + image * taille;
+  const uint8_t* masque = s.lire(&Sprite::masque);
+  if (masque) masque += image * taille;
+  uint8_t* t = tampon + x;
+  
+  // Page du sprite dont le BAS de l'octet tombe ici, et celle
+  // dont le HAUT tombe ici (Sprite page landing with its low
+  // byte here, and the one landing with its high byte)
+  int kBas = -q;
+  int kHaut = -q - 1;
+  bool avecBas = kBas >= 0 && kBas < pages;
+  bool avecHaut = r != 0 && kHaut >= 0 && kHaut < pages;
+  
+  // Chemin rapide: page alignée, copie directe (Fast path: aligned page, direct copy)
+  if (r == 0) {
+    const uint8_t* d = dessin + kBas * largeur;
+    const uint8_t* m = masque ? masque + kBas * largeur : nullptr;
+    for (int i = debut; i < fin; i++) {
+      uint8_t octet = pgm_read_byte(d + i);
+      if (m) t[i] &= ~pgm_read_byte(m + i);
+      t[i] |= octet;
+    }
+    return;
+  }
+  
+  // Décaler et OR (Shift and OR)
+  uint8_t facteur = 1 << r;
+  const uint8_t* dBas = dessin + kBas * largeur;
+  const uint8_t* dHaut = dessin + kHaut * largeur;
+  const uint8_t* mBas = masque + kBas * largeur;
+  const uint8_t* mHaut = masque + kHaut * largeur;
+  for (int i = debut; i < fin; i++) {
+    uint8_t octet = 0;
+    uint8_t bord = 0;
+    if (avecBas) {
+      octet = (uint8_t)(pgm_read_byte(dBas + i) * facteur);
+      if (masque) bord = (uint8_t)(pgm_read_byte(mBas + i) * facteur);
+    }
+    if (avecHaut) {
+      octet |= (uint16_t)(pgm_read_byte(dHaut + i) * facteur) >> 8;
+      if (masque) bord |= (uint16_t)(pgm_read_byte(mHaut + i) * facteur) >> 8;
+    }
+    t[i] = (t[i] & ~bord) | octet;
+  }
+}
+
+// Dans DESSINER_ECRAN (Inside DESSINER_ECRAN)
+inline void dessinerSprite(int x, int y, const Sprite* sprite, uint8_t image) {
+  dessinerSpritePage(tamponPage(), numeroPage(), x, y, sprite, image);
+}
+
+// Deux sprites se touchent au pixel près? Le masque sert de
+// forme, ou le dessin s'il n'y en a pas. Voir phys_toucheMasques.
+// (Do two sprites touch, pixel-perfect? The mask is the shape,
+// or the picture when there is none. See phys_toucheMasques.)
+inline const uint8_t* formeSprite(PmStruct<Sprite> s, uint8_t image) {
+  const uint8_t* forme = s.lire(&Sprite::masque);
+  if (!forme) forme = s.lire(&Sprite::dessin);
+  return forme + image * (uint16_t)(s.lire(&Sprite::pages) * s.lire(&Sprite::largeur));
+}
+
+bool toucheSprites(int x1, int y1, const Sprite* sprite1, uint8_t image1,
+                   int x2, int y2, const Sprite* sprite2, uint8_t image2) {
+  PmStruct<Sprite> s1 = { sprite1 };
+  PmStruct<Sprite> s2 = { sprite2 };
+  uint8_t largeur1 = s1.lire(&Sprite::largeur);
+  uint8_t hauteur1 = s1.lire(&Sprite::hauteur);
+  uint8_t largeur2 = s2.lire(&Sprite::largeur);
+  uint8_t hauteur2 = s2.lire(&Sprite::hauteur);
+  // Boîtes d'abord: un raté ne cherche pas les masques
+  // (Boxes first: a miss does not look up the masks)
+  if (!phys_toucheBoite(x1, y1, largeur1 - 1, hauteur1 - 1, x2, y2, largeur2 - 1, hauteur2 - 1)) {
+    return false;
+  }
+  return phys_toucheMasques(x1, y1, formeSprite(s1, image1), largeur1, hauteur1,
+                            x2, y2, formeSprite(s2, image2), largeur2, hauteur2);
+}
+
+// Une boîte pleine touche un sprite au pixel près? Pour ce qui
+// n'a pas d'image (formes dessinées) contre ce qui en a une.
+// (Does a solid box touch a sprite, pixel-perfect? For what has
+// no picture - drawn shapes - against what has one.)
+bool toucheBoiteSprite(int x1, int y1, int largeur1, int hauteur1,
+                       int x2, int y2, const Sprite* sprite2, uint8_t image2) {
+  PmStruct<Sprite> s2 = { sprite2 };
+  int largeur2 = s2.lire(&Sprite::largeur);
+  int hauteur2 = s2.lire(&Sprite::hauteur);
+  if (!phys_toucheBoite(x1, y1, largeur1 - 1, hauteur1 - 1, x2, y2, largeur2 - 1, hauteur2 - 1)) {
+    return false;
+  }
+  
+  // Zone commune, en pixels du sprite (Shared area, in sprite pixels)
+  int colDebut = (x1 > x2 ? x1 : x2) - x2;
+  int colFin = (x1 + largeur1 < x2 + largeur2 ? x1 + largeur1 : x2 + largeur2) - x2;
+  int ligneDebut = (y1 > y2 ? y1 : y2) - y2;
+  int ligneFin = (y1 + hauteur1 < y2 + hauteur2 ? y1 + hauteur1 : y2 + hauteur2) - y2;
+  
+  const uint8_t* forme = formeSprite(s2, image2);
+  for (int ligne = ligneDebut; ligne < ligneFin; ligne++) {
+    const uint8_t* page = forme + (ligne >> 3) * largeur2;
+    uint8_t bit = 1 << (ligne & 7);
+    for (int col = colDebut; col < colFin; col++) {
+      if (pgm_read_byte(page + col) & bit) return true;
+    }
+  }
+  return false;
+}
+
+// ----------------------------------------------------------
+// Animations (Animations)
+// ----------------------------------------------------------
+// Une animation = une liste d'images en PROGMEM. "vitesse":
+// l'image change tous les 2^vitesse tics.
+// (An animation = a list of frames in PROGMEM. "vitesse": the
+// frame changes every 2^vitesse ticks.)
+//
+//   ANIMATION_PROGMEM(mh_animClignement, 2, 0, 0, 0, 0, 0, 0, 0, 1);
+//   dessinerSprite(x, y, &spr_monstre, imageAnimation(mh_animClignement, millis() >> 6));
+
+#define ANIMATION_PROGMEM(nom, vitesse, ...) \
+  const uint8_t nom[] PROGMEM = { vitesse, __VA_ARGS__ }
+
+// Image à montrer au tic "tic" (Frame to show at tick "tic")
+template <size_t N>
+inline uint8_t imageAnimation(const uint8_t (&animation)[N], uint16_t tic) {
+  uint16_t etape = tic >> pgm_read_byte(&animation[0]);
+  return pgm_read_byte(&animation[1 + etape % (N - 1)]);
+}
+
 #endif
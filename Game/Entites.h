@@ -0,0 +1,122 @@
+// ==========================================================
+// ENTITES.H - Petit système entité-composant
+// (Tiny entity-component system)
+// ==========================================================
+// Une entité n'est qu'un numéro, de 0 à N-1. Ce qu'elle EST
+// tient dans UN octet: un bit par composant (position,
+// vitesse, ennemi...). Les données d'un composant sont un
+// tableau du jeu, rangé par numéro d'entité:
+//   int mh_entX[MH_ENTITES];   // Composant "position"
+// Un système est une boucle sur les entités qui ont TOUS les
+// bits demandés: lire N octets, un ET, une comparaison. Le
+// coût par image est donc fixe (N tours), quel que soit le
+// mélange d'entités vivantes.
+// (An entity is just a number, 0 to N-1. What it IS fits in
+// ONE byte: one bit per component. A component's data is a
+// game array indexed by entity number. A system is a loop
+// over the entities that have ALL the requested bits: N bytes
+// read, an AND, a compare - a fixed cost per frame, whatever
+// entities are alive.)
+//
+// RAM: 1 octet par entité + les tableaux de composants.
+// (RAM: 1 byte per entity + the component arrays.)
+//
+//   #define MH_POSITION ENT_COMPOSANT(0)
+//   #define MH_TIR      ENT_COMPOSANT(1)
+//   Entites<6> monde;
+//   uint8_t e = monde.creer(MH_POSITION | MH_TIR);
+//   POUR_CHAQUE_ENTITE(monde, MH_POSITION | MH_TIR, t) { ... }
+//   monde.detruire(e);
+// ==========================================================
+
+#ifndef ENTITES_H
+#define ENTITES_H
+
+#include <Arduino.h>
+
+// Numéro "pas d'entité" (No entity)
+#define ENT_AUCUNE 0xFF
+
+// Bit 7: l'entité existe. Les jeux ont les bits 0 à 6.
+// (Bit 7: the entity exists. Games get bits 0 to 6.)
+#define ENT_VIVANTE 0x80
+#define ENT_COMPOSANT(n) ((uint8_t)(1 << (n)))
+
+// ==========================================================
+// MONDE D'ENTITÉS (Entity world)
+// ==========================================================
+// N fixé à la compilation, 254 au plus (ENT_AUCUNE = 255).
+// (N fixed at compile time, 254 at most.)
+
+template <uint8_t N>
+struct Entites {
+  uint8_t composants[N];  // 0 = numéro libre (0 = free number)
+
+  Entites() { vider(); }
+
+  void vider() {
+    for (uint8_t e = 0; e < N; e++) composants[e] = 0;
+  }
+
+  // Prend un numéro libre, ENT_AUCUNE si plein. Les tableaux
+  // de composants gardent leurs anciennes valeurs: à remplir!
+  // (Takes a free number, ENT_AUCUNE if full. Component arrays
+  // keep their old values: fill them in!)
+  uint8_t creer(uint8_t masque) {
+    for (uint8_t e = 0; e < N; e++) {
+      if (!composants[e]) {
+        composants[e] = masque | ENT_VIVANTE;
+        return e;
+      }
+    }
+    return ENT_AUCUNE;
+  }
+
+  void detruire(uint8_t e) { composants[e] = 0; }
+
+  void ajouter(uint8_t e, uint8_t masque) { composants[e] |= masque; }
+  void retirer(uint8_t e, uint8_t masque) { composants[e] &= ~masque; }
+
+  // L'entité existe et a tous ces composants?
+  // (The entity exists and has all these components?)
+  bool a(uint8_t e, uint8_t masque) const {
+    masque |= ENT_VIVANTE;
+    return (composants[e] & masque) == masque;
+  }
+
+  // Prochaine entité à partir de e qui a tout le masque,
+  // ENT_AUCUNE si aucune (Next entity from e with the whole
+  // mask, ENT_AUCUNE if none)
+  uint8_t suivante(uint8_t e, uint8_t masque) const {
+    masque |= ENT_VIVANTE;
+    for (; e < N; e++) {
+      if ((composants[e] & masque) == masque) return e;
+    }
+    return ENT_AUCUNE;
+  }
+
+  uint8_t premiere(uint8_t masque) const { return suivante(0, masque); }
+
+  uint8_t compter(uint8_t masque) const {
+    uint8_t n = 0;
+    for (uint8_t e = suivante(0, masque); e != ENT_AUCUNE; e = suivante(e + 1, masque)) n++;
+    return n;
+  }
+};
+
+// Boucle sur les entités qui ont tout le masque. Détruire e
+// dans la boucle est permis. (Loop over the entities with the
+// whole mask. Destroying e inside the loop is allowed.)
+#define POUR_CHAQUE_ENTITE(monde, masque, e) \
+  for (uint8_t e = (monde).suivante(0, masque); e != ENT_AUCUNE; e = (monde).suivante(e + 1, masque))
+
+// Un système = une fonction appelée pour chaque entité du masque
+// (A system = a function called for each entity of the mask)
+template <uint8_t N>
+inline void ent_executer(Entites<N>* monde, uint8_t masque, void (*systeme)(uint8_t e)) {
+  POUR_CHAQUE_ENTITE(*monde, masque, e) {
+    systeme(e);
+  }
+}
+
+#endif
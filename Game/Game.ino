@@ -11,8 +11,10 @@
 // Inclure tous les modules (Include all modules)
 #include "Display.h"    // Écran OLED (OLED screen)
 #include "Input.h"      // Joystick et bouton (Joystick and button)
+#include "Taches.h"     // Tâches qui attendent sans bloquer (Non-blocking tasks)
 #include "Melodies.h"   // Sons et mélodies (Sounds and melodies)
 #include "GameBase.h"   // Structure des jeux (Game structure)
+#include "Minuteries.h" // Minuteries en tours de jeu (Timers in game ticks)
 #include "Menu.h"       // Menu principal (Main menu)
 
 // Inclure les jeux (Include games)
@@ -31,6 +33,13 @@
 int etatSysteme = SYSTEME_DEMARRAGE;  // État actuel (Current state)
 int jeuActuel = -1;                    // Jeu en cours (-1 = aucun) (Current game, -1 = none)
 
+// Un tour de menu ou de jeu tous les DUREE_TOUR ms au plus. Entre
+// deux tours, les tâches (mélodies, attentes) tournent et le
+// processeur dort. (One menu or game tick every DUREE_TOUR ms at
+// most. Between ticks, tasks run and the CPU sleeps.)
+#define DUREE_TOUR 30
+unsigned long finDernierTour = 0;
+
 // ==========================================================
 // SETUP - Préparation du système
 // ==========================================================
@@ -56,13 +65,8 @@ void setup() {
   menu_ajouterJeu(infoBreakout.nom);
   
   // Afficher l'écran de démarrage (Show startup screen)
+  // loop() attend le bouton (loop() waits for the button)
   menu_afficherDemarrage();
-  
-  // Attendre que le joueur appuie (Wait for player to press)
-  menu_attendreBouton();
-  
-  // Passer au menu (Go to menu)
-  etatSysteme = SYSTEME_MENU;
 }
 
 // ==========================================================
@@ -70,10 +74,31 @@ void setup() {
 // ==========================================================
 
 void loop() {
+  // Les tâches d'abord: notes des mélodies, fins d'attente
+  // (Tasks first: melody notes, ends of waits)
+  taches_avancer();
+  
+  // Pendant une attente ou avant la fin du tour: dormir
+  // (During a wait or before the tick is over: sleep)
+  if (enAttente() || millis() - finDernierTour < DUREE_TOUR) {
+    taches_dormir();
+    return;
+  }
+  
   // Selon l'état du système (Depending on system state)
   
+  // ===== DÉMARRAGE =====
+  if (etatSysteme == SYSTEME_DEMARRAGE) {
+    // Attendre que le joueur appuie (Wait for player to press)
+    if (menu_attendreBouton()) {
+      etatSysteme = SYSTEME_MENU;  // Passer au menu (Go to menu)
+    }
+  }
+  
   // ===== MENU =====
-  if (etatSysteme == SYSTEME_MENU) {
+  // Pas dans le tour du démarrage: le bouton est encore enfoncé
+  // (Not in the startup tick: the button is still down)
+  else if (etatSysteme == SYSTEME_MENU) {
     // Mettre à jour le menu (Update menu)
     int selection = menu_update();
     
@@ -88,10 +113,21 @@ void loop() {
   }
   
   // ===== JEU EN COURS =====
-  if (etatSysteme == SYSTEME_JEU) {
+  // Un jeu qui vient d'être lancé peut attendre (instructions)
+  // (A game just launched may be waiting - instructions screen)
+  if (etatSysteme == SYSTEME_JEU && !enAttente()) {
+    // Un tour de plus: les minuteries dues sonnent avant le jeu
+    // (One more tick: due timers ring before the game runs)
+    minu_avancer(&minu_jeu);
+    
     // Exécuter la boucle du jeu (Run game loop)
     executerJeu(jeuActuel);
   }
+  
+  // Le prochain tour part d'ici, comme l'ancien delay(30) en fin
+  // de boucle (The next tick starts from here, like the old
+  // delay(30) at the end of the loop)
+  finDernierTour = millis();
 }
 
 // ==========================================================
@@ -100,6 +136,11 @@ void loop() {
 
 // Lancer un jeu (Launch a game)
 void lancerJeu(int numeroJeu) {
+  // Les minuteries et événements du jeu d'avant s'arrêtent
+  // (Previous game's timers and events stop)
+  minu_vider(&minu_jeu);
+  evt_vider();
+  
   // Choisir quel jeu lancer (Choose which game to launch)
   
   if (numeroJeu == 0) {
@@ -122,19 +163,24 @@ void lancerJeu(int numeroJeu) {
 }
 
 // Exécuter la boucle d'un jeu (Run a game's loop)
+// Puis ses événements: sons, score, niveau (GameBase.h)
+// (Then its events: sounds, score, level)
 void executerJeu(int numeroJeu) {
   if (numeroJeu == 0) {
     // Monster Hunter!
     mh_loopJeu();
+    evt_traiter(mh_traiterEvenement);
   }
   
   if (numeroJeu == 1) {
     // Aventurier!
     av_loopJeu();
+    evt_traiter(av_traiterEvenement);
   }
   
   if (numeroJeu == 2) {
     // Breakout!
     br_loopJeu();
+    evt_traiter(br_traiterEvenement);
   }
 }
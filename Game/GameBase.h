@@ -11,6 +11,8 @@
 #ifndef GAME_BASE_H
 #define GAME_BASE_H
 
+#include "Taches.h"
+
 // ==========================================================
 // ÉTATS DU JEU (Game states)
 // ==========================================================
@@ -35,6 +37,165 @@ struct InfoJeu {
   const char* description; // Petite description (Short description)
 };
 
+// ==========================================================
+// TRAVAIL PENDANT LES ATTENTES (Work during waits)
+// ==========================================================
+// Au lieu de delay(1500) sur un écran "BRAVO!", on fait du
+// travail utile (préparer le niveau suivant) par petites
+// tranches pendant que le joueur lit l'écran.
+// (Instead of delay(1500) on a "BRAVO!" screen, useful work -
+// preparing the next level - runs in small slices while the
+// player reads the screen.)
+//
+// L'attente est une tâche (Taches.h): la fonction revient tout
+// de suite, et loop() (Game.ino) ne relance PAS le jeu tant que
+// enAttente(). Les mélodies continuent de jouer pendant ce temps.
+// (The wait is a task: the function returns at once, and
+// loop() does NOT run the game again while enAttente(). Melodies
+// keep playing meanwhile.)
+
+// Une tranche de travail: retourne true s'il en reste
+// (One slice of work: returns true while work remains)
+typedef bool (*TrancheTravail)();
+
+unsigned long attente_fin = 0;             // millis() de la fin (End time)
+TrancheTravail attente_tranche = nullptr;  // nullptr = plus de travail (no more work)
+
+// La tâche: une tranche par passage, puis attendre la fin
+// (The task: one slice per pass, then wait for the end)
+bool attente_tache(Tache* t) {
+  TACHE_DEBUT(t);
+  while (attente_tranche) {
+    if (!attente_tranche()) attente_tranche = nullptr;
+    TACHE_CEDER(t);
+  }
+  TACHE_ATTENDRE_JUSQUA(t, attente_fin);
+  TACHE_FIN(t);
+}
+
+// Le jeu attend-il encore? (Is the game still waiting?)
+bool enAttente() {
+  return tache_active(attente_tache);
+}
+
+// Attendre "duree" ms en appelant tranche() tant qu'il y a du
+// travail. Si le temps est fini avant, on termine quand même:
+// le jeu ne repart que quand le travail est TOUJOURS fini.
+// Deux attentes de suite: la plus longue gagne, et le travail
+// de la première est fini tout de suite.
+// (Wait "duree" ms, calling tranche() while there is work. If
+// time runs out first, finish anyway: the game only resumes
+// once the work is ALWAYS done. Two waits in a row: the longer
+// one wins, and the first one's work is finished right away.)
+void attendreEnTravaillant(unsigned long duree, TrancheTravail tranche) {
+  while (attente_tranche && attente_tranche()) { }
+  
+  unsigned long fin = millis() + duree;
+  if (!enAttente() || (long)(fin - attente_fin) > 0) {
+    attente_fin = fin;
+  }
+  attente_tranche = tranche;
+  if (!tache_lancer(attente_tache)) {
+    // Pas de case: le travail tout de suite, sans l'attente
+    // (No slot: the work right away, without the wait)
+    while (attente_tranche && attente_tranche()) { }
+    attente_tranche = nullptr;
+  }
+}
+
+// Une simple pause, sans travail (A plain pause, no work)
+void patienter(unsigned long duree) {
+  attendreEnTravaillant(duree, nullptr);
+}
+
+// ==========================================================
+// ÉVÉNEMENTS DU JEU (Game events)
+// ==========================================================
+// Pendant la simulation, le jeu POSTE ce qui arrive (un bloc
+// touché, des points, un niveau...) au lieu de jouer le son et
+// changer le score tout de suite. Game.ino les traite tous
+// après la boucle du jeu, donc après le dessin: un seul
+// endroit par tour pour les sons, le score et la barre du haut.
+// (During the simulation the game POSTS what happens instead
+// of playing the sound and changing the score right away.
+// Game.ino handles them all after the game loop, so after
+// drawing: one place per tick for sounds, score and HUD.)
+//
+// File circulaire de EVT_MAX événements: 3 octets chacun.
+// (Ring buffer of EVT_MAX events: 3 bytes each.)
+
+#define EVT_TOUCHE 1   // valeur = ce qui est touché, au jeu de choisir
+#define EVT_POINTS 2   // valeur = points gagnés (Points won)
+#define EVT_NIVEAU 3   // valeur = nouveau niveau (New level)
+#define EVT_FIN 4      // Partie perdue (Game over)
+#define EVT_JEU 16     // Types propres à un jeu: EVT_JEU + n (Game-specific types)
+
+#define EVT_MAX 8      // Puissance de 2 (Power of 2)
+
+struct Evenement {
+  uint8_t type;
+  int16_t valeur;
+};
+
+struct FileEvenements {
+  Evenement evenements[EVT_MAX];
+  uint8_t debut;    // Le plus ancien (Oldest)
+  uint8_t nombre;
+};
+
+FileEvenements evt_file = { {}, 0, 0 };
+
+// Que fait le jeu d'un événement (What the game does with an event)
+typedef void (*TraiterEvenement)(const Evenement* evenement);
+
+void evt_vider() {
+  evt_file.debut = 0;
+  evt_file.nombre = 0;
+}
+
+// Poster un événement. Des points qui suivent des points
+// s'ajoutent au même événement. Retourne false si la file est
+// pleine: l'événement est perdu.
+// (Post an event. Points right after points are added to the
+// same event. Returns false if the queue is full: the event is
+// lost.)
+bool evt_poster(uint8_t type, int valeur = 0) {
+  if (type == EVT_POINTS && evt_file.nombre > 0) {
+    Evenement* dernier = &evt_file.evenements[(evt_file.debut + evt_file.nombre - 1) & (EVT_MAX - 1)];
+    if (dernier->type == EVT_POINTS) {
+      dernier->valeur += valeur;
+      return true;
+    }
+  }
+  if (evt_file.nombre >= EVT_MAX) return false;
+  Evenement* e = &evt_file.evenements[(evt_file.debut + evt_file.nombre) & (EVT_MAX - 1)];
+  e->type = type;
+  e->valeur = valeur;
+  evt_file.nombre++;
+  return true;
+}
+
+// Le plus ancien événement, false si la file est vide
+// (The oldest event, false if the queue is empty)
+bool evt_lire(Evenement* evenement) {
+  if (evt_file.nombre == 0) return false;
+  *evenement = evt_file.evenements[evt_file.debut];
+  evt_file.debut = (evt_file.debut + 1) & (EVT_MAX - 1);
+  evt_file.nombre--;
+  return true;
+}
+
+// Traiter toute la file, dans l'ordre. Un événement posté
+// pendant le traitement passe dans le même tour.
+// (Handle the whole queue, in order. An event posted while
+// handling runs in the same tick.)
+void evt_traiter(TraiterEvenement traiter) {
+  Evenement e;
+  while (evt_lire(&e)) {
+    traiter(&e);
+  }
+}
+
 // ==========================================================
 // EXPLICATION DU SYSTÈME (System explanation)
 // ==========================================================
@@ -5,11 +5,23 @@
 // Ce fichier contient toutes les mélodies du jeu.
 // Tu peux les utiliser dans n'importe quel jeu!
 // (This file contains all game melodies - use them in any game!)
+//
+// Une mélodie est une liste de notes en Flash. melodieTir()
+// et les autres la LANCENT et reviennent tout de suite: une
+// tâche (Taches.h) joue les notes pendant que le jeu tourne.
+// Celles d'un même tour se suivent, comme avant; celle d'un
+// tour suivant remplace la mélodie en cours.
+// (A melody is a list of notes in Flash. melodieTir() and the
+// others START it and return at once: a task plays the notes
+// while the game runs. Those of one tick play in turn, as
+// before; one from a later tick replaces the current melody.)
 // ==========================================================
 
 #ifndef MELODIES_H
 #define MELODIES_H
 
+#include "Taches.h"
+
 // La broche du buzzer (Buzzer pin)
 #define BUZZER_PIN 8
 
@@ -22,148 +34,165 @@ void setupBuzzer() {
   pinMode(BUZZER_PIN, OUTPUT);
 }
 
+// ==========================================================
+// LECTEUR DE MÉLODIES (Melody player)
+// ==========================================================
+
+struct Note {
+  uint16_t frequence;  // Hz, 0 = fin (end)
+  uint16_t duree;      // Durée du son en ms (Sound length)
+  uint16_t pas;        // ms avant la note suivante (ms before the next note)
+};
+
+// Une mélodie en Flash, terminée par une note 0
+// (A melody in Flash, ended by a 0 note)
+#define MELODIE_PROGMEM(nom, ...) \
+  const Note nom[] PROGMEM = { __VA_ARGS__, { 0, 0, 0 } }
+
+// Les mélodies demandées pendant le MÊME tour se suivent (une
+// case touchée, puis la fanfare, puis l'alerte...). Une mélodie
+// demandée à un tour suivant remplace tout.
+// (Melodies asked for during the SAME tick play one after the
+// other - a hit, then the fanfare, then the alert... A melody
+// asked for on a later tick replaces them all.)
+#define MEL_FILE 4
+
+const Note* mel_file[MEL_FILE];  // [0] = en cours (current)
+uint8_t mel_nombre = 0;
+uint8_t mel_index = 0;
+bool mel_memeTour = false;  // Pas encore de passage de la tâche (No task pass yet)
+
+// La tâche qui joue: une note, puis attendre son "pas"
+// (The playing task: one note, then wait its "pas")
+bool mel_jouer(Tache* t) {
+  mel_memeTour = false;  // À chaque passage (On every pass)
+  TACHE_DEBUT(t);
+  while (mel_nombre > 0) {
+    while (pgm_read_word(&mel_file[0][mel_index].frequence) != 0) {
+      tone(BUZZER_PIN, pgm_read_word(&mel_file[0][mel_index].frequence),
+           pgm_read_word(&mel_file[0][mel_index].duree));
+      mel_index++;
+      TACHE_ATTENDRE(t, pgm_read_word(&mel_file[0][mel_index - 1].pas));
+    }
+    // La suivante de la file (The next one in the queue)
+    for (uint8_t i = 1; i < mel_nombre; i++) mel_file[i - 1] = mel_file[i];
+    mel_nombre--;
+    mel_index = 0;
+  }
+  TACHE_FIN(t);
+}
+
+// Une mélodie joue encore? (Is a melody still playing?)
+bool melodieEnCours() {
+  return tache_active(mel_jouer);
+}
+
+// Lancer une mélodie: après celles du même tour, sinon à la
+// place de celle en cours. File pleine: oubliée.
+// (Start a melody: after those of the same tick, otherwise
+// instead of the current one. Queue full: dropped.)
+void jouerMelodie(const Note* notes) {
+  if (mel_memeTour && melodieEnCours()) {
+    if (mel_nombre < MEL_FILE) mel_file[mel_nombre++] = notes;
+    return;
+  }
+  mel_file[0] = notes;
+  mel_nombre = 1;
+  mel_index = 0;
+  mel_memeTour = true;
+  if (!tache_lancer(mel_jouer)) mel_nombre = 0;  // Pas de case: silence (No slot: silence)
+}
+
 // ==========================================================
 // MÉLODIES DU MENU (Menu melodies)
 // ==========================================================
 
 // Son de démarrage du système (System startup sound)
 // Joue 3 notes qui montent!  (Plays 3 rising notes!)
-void melodieStartup() {
-  tone(BUZZER_PIN, 523, 100);  // Do (C)
-  delay(150);
-  tone(BUZZER_PIN, 659, 100);  // Mi (E)
-  delay(150);
-  tone(BUZZER_PIN, 784, 200);  // Sol (G)
-  delay(300);
-  noTone(BUZZER_PIN);
-}
+MELODIE_PROGMEM(mel_startup,
+  { 523, 100, 150 },  // Do (C)
+  { 659, 100, 150 },  // Mi (E)
+  { 784, 200, 300 }   // Sol (G)
+);
+void melodieStartup() { jouerMelodie(mel_startup); }
 
 // Son de sélection dans le menu (Menu selection sound)
-void melodieMenuSelect() {
-  tone(BUZZER_PIN, 1000, 50);
-  delay(50);
-  noTone(BUZZER_PIN);
-}
+MELODIE_PROGMEM(mel_menuSelect, { 1000, 50, 50 });
+void melodieMenuSelect() { jouerMelodie(mel_menuSelect); }
 
 // Son de confirmation (Confirmation sound)
-void melodieConfirm() {
-  tone(BUZZER_PIN, 800, 80);
-  delay(100);
-  tone(BUZZER_PIN, 1200, 100);
-  delay(100);
-  noTone(BUZZER_PIN);
-}
+MELODIE_PROGMEM(mel_confirm, { 800, 80, 100 }, { 1200, 100, 100 });
+void melodieConfirm() { jouerMelodie(mel_confirm); }
 
 // ==========================================================
 // MÉLODIES DE JEU (Game melodies)
 // ==========================================================
 
 // Son de tir (Shooting sound)
-void melodieTir() {
-  tone(BUZZER_PIN, 1500, 30);
-  delay(30);
-  noTone(BUZZER_PIN);
-}
+MELODIE_PROGMEM(mel_tir, { 1500, 30, 30 });
+void melodieTir() { jouerMelodie(mel_tir); }
 
 // Son de pas de munitions (No ammo sound)
-void melodiePasDeMunitions() {
-  tone(BUZZER_PIN, 150, 100);
-  delay(100);
-  noTone(BUZZER_PIN);
-}
+MELODIE_PROGMEM(mel_pasDeMunitions, { 150, 100, 100 });
+void melodiePasDeMunitions() { jouerMelodie(mel_pasDeMunitions); }
 
 // Son de rechargement (Reload sound)
-void melodieRecharge() {
-  tone(BUZZER_PIN, 880, 50);
-  delay(50);
-  tone(BUZZER_PIN, 1100, 50);
-  delay(50);
-  tone(BUZZER_PIN, 1320, 50);
-  noTone(BUZZER_PIN);
-}
+MELODIE_PROGMEM(mel_recharge, { 880, 50, 50 }, { 1100, 50, 50 }, { 1320, 50, 50 });
+void melodieRecharge() { jouerMelodie(mel_recharge); }
 
 // Son quand monstre touché (Monster hit sound)
-void melodieMonstreTouche() {
-  tone(BUZZER_PIN, 600, 50);
-  delay(60);
-  tone(BUZZER_PIN, 800, 50);
-  delay(60);
-  tone(BUZZER_PIN, 1000, 100);
-  noTone(BUZZER_PIN);
-}
+MELODIE_PROGMEM(mel_monstreTouche, { 600, 50, 60 }, { 800, 50, 60 }, { 1000, 100, 100 });
+void melodieMonstreTouche() { jouerMelodie(mel_monstreTouche); }
 
 // Son quand boss touché (Boss hit sound)
-void melodieBossTouche() {
-  tone(BUZZER_PIN, 400, 50);
-  delay(60);
-  tone(BUZZER_PIN, 600, 50);
-  noTone(BUZZER_PIN);
-}
+MELODIE_PROGMEM(mel_bossTouche, { 400, 50, 60 }, { 600, 50, 50 });
+void melodieBossTouche() { jouerMelodie(mel_bossTouche); }
 
 // ==========================================================
 // MÉLODIES DE VICTOIRE (Victory melodies)
 // ==========================================================
 
 // Son de niveau supérieur (Level up sound)
-void melodieNiveauSup() {
-  tone(BUZZER_PIN, 523, 100);
-  delay(100);
-  tone(BUZZER_PIN, 659, 100);
-  delay(100);
-  tone(BUZZER_PIN, 784, 100);
-  delay(100);
-  tone(BUZZER_PIN, 1047, 200);
-  noTone(BUZZER_PIN);
-}
+MELODIE_PROGMEM(mel_niveauSup,
+  { 523, 100, 100 },
+  { 659, 100, 100 },
+  { 784, 100, 100 },
+  { 1047, 200, 200 }
+);
+void melodieNiveauSup() { jouerMelodie(mel_niveauSup); }
 
 // Son de victoire contre le boss (Boss defeat sound)
-void melodieVictoireBoss() {
-  tone(BUZZER_PIN, 523, 100);
-  delay(100);
-  tone(BUZZER_PIN, 659, 100);
-  delay(100);
-  tone(BUZZER_PIN, 784, 100);
-  delay(100);
-  tone(BUZZER_PIN, 1047, 300);
-  noTone(BUZZER_PIN);
-}
+MELODIE_PROGMEM(mel_victoireBoss,
+  { 523, 100, 100 },
+  { 659, 100, 100 },
+  { 784, 100, 100 },
+  { 1047, 300, 300 }
+);
+void melodieVictoireBoss() { jouerMelodie(mel_victoireBoss); }
 
 // ==========================================================
 // MÉLODIES DE DÉFAITE (Defeat melodies)
 // ==========================================================
 
 // Son de défaite / game over (Defeat / game over sound)
-void melodieGameOver() {
-  tone(BUZZER_PIN, 400, 200);
-  delay(250);
-  tone(BUZZER_PIN, 300, 200);
-  delay(250);
-  tone(BUZZER_PIN, 200, 400);
-  delay(500);
-  noTone(BUZZER_PIN);
-}
+MELODIE_PROGMEM(mel_gameOver, { 400, 200, 250 }, { 300, 200, 250 }, { 200, 400, 500 });
+void melodieGameOver() { jouerMelodie(mel_gameOver); }
 
 // ==========================================================
 // MÉLODIES D'ALERTE (Alert melodies)
 // ==========================================================
 
 // Son d'alerte du boss (Boss alert sound)
-void melodieAlerteBoss() {
-  tone(BUZZER_PIN, 200, 200);
-  delay(250);
-  tone(BUZZER_PIN, 200, 200);
-  delay(250);
-  tone(BUZZER_PIN, 200, 200);
-  delay(250);
-  tone(BUZZER_PIN, 400, 400);
-  noTone(BUZZER_PIN);
-}
+MELODIE_PROGMEM(mel_alerteBoss,
+  { 200, 200, 250 },
+  { 200, 200, 250 },
+  { 200, 200, 250 },
+  { 400, 400, 400 }
+);
+void melodieAlerteBoss() { jouerMelodie(mel_alerteBoss); }
 
 // Son de redémarrage (Restart sound)
-void melodieRestart() {
-  tone(BUZZER_PIN, 523, 100);
-  delay(100);
-  noTone(BUZZER_PIN);
-}
+MELODIE_PROGMEM(mel_restart, { 523, 100, 100 });
+void melodieRestart() { jouerMelodie(mel_restart); }
 
 #endif
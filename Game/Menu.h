@@ -108,7 +108,7 @@ int menu_update() {
   // Vérifier le bouton pour confirmer (Check button to confirm)
   if (boutonJustePresse()) {
     melodieConfirm();
-    delay(200);
+    patienter(200);
     return menu_jeuSelectionne;
   }
   
@@ -138,22 +138,30 @@ void menu_afficherDemarrage() {
   melodieStartup();
 }
 
-// Attendre que le joueur appuie (Wait for player to press)
-void menu_attendreBouton() {
+// Le bouton a été relâché depuis l'écran de démarrage?
+// (Was the button released since the startup screen?)
+bool menu_boutonRelache = false;
+
+// Attendre que le joueur appuie: appelée à chaque tour par
+// loop(), retourne true à la pression (sans bloquer).
+// (Wait for player to press: called each tick by loop(),
+// returns true on the press - without blocking.)
+bool menu_attendreBouton() {
   // Attendre que le bouton soit relâché d'abord
   // (Wait for button to be released first)
-  while (digitalRead(JOYSTICK_BUTTON) == LOW) {
-    delay(10);
+  if (digitalRead(JOYSTICK_BUTTON) == HIGH) {
+    menu_boutonRelache = true;
+    return false;
   }
   
-  // Attendre une nouvelle pression
-  // (Wait for new press)
-  while (digitalRead(JOYSTICK_BUTTON) == HIGH) {
-    delay(10);
+  // Puis une nouvelle pression (Then a new press)
+  if (!menu_boutonRelache) {
+    return false;
   }
   
   melodieConfirm();
-  delay(200);
+  patienter(200);
+  return true;
 }
 
 #endif
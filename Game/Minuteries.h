@@ -0,0 +1,213 @@
+// ==========================================================
+// MINUTERIES.H - Minuteries en tours de jeu
+// (Timers counted in game ticks)
+// ==========================================================
+// Un tour = un appel de la boucle du jeu. Game.ino avance
+// minu_jeu d'un tour avant chaque boucle: une minuterie
+// "sonne" au bon tour, appelle son action (si elle en a une)
+// et lève son drapeau. Le jeu n'a plus de compteur à tenir.
+// (One tick = one call of the game loop. Game.ino advances
+// minu_jeu by one tick before each loop: a timer "rings" on
+// the right tick, calls its action - if any - and raises its
+// flag. The game has no counter to keep.)
+//
+// Roue à 2 niveaux de 8 seaux (Two-level wheel, 8 buckets each):
+// - niveau 0: un seau par tour, les 8 prochains tours
+//   (level 0: one bucket per tick, the next 8 ticks)
+// - niveau 1: un seau par 8 tours, les 64 prochains tours;
+//   vidé dans le niveau 0 quand son tour arrive
+//   (level 1: one bucket per 8 ticks, the next 64 ticks -
+//   poured into level 0 when its turn comes)
+// Plus loin que 64 tours: rangée au bout du niveau 1 et
+// replacée à chaque passage. Lancer et arrêter = O(1) (listes
+// doublement chaînées), un tour ne regarde QUE les minuteries
+// qui sonnent ou descendent de niveau.
+// (Further than 64 ticks: stored at the end of level 1 and
+// re-placed each pass. Start and stop are O(1) - doubly linked
+// lists - and a tick only looks at the timers that ring or
+// move down a level.)
+//
+// Les numéros 0 à N-1 sont choisis par le jeu:
+// (Numbers 0 to N-1 are chosen by the game:)
+//   #define AV_MINU_MARCHE 0
+//   minu_lancer(&minu_jeu, AV_MINU_MARCHE, 4, 4, av_changerPas);
+//   if (minu_sonne(&minu_jeu, BR_MINU_BONUS)) { ... }
+// ==========================================================
+
+#ifndef MINUTERIES_H
+#define MINUTERIES_H
+
+#include <Arduino.h>
+
+#define MINU_BITS 3
+#define MINU_SEAUX (1 << MINU_BITS)  // Seaux par niveau (Buckets per level)
+#define MINU_MASQUE (MINU_SEAUX - 1)
+#define MINU_AUCUNE 0xFF             // Fin de liste / arrêtée (End of list / stopped)
+#define MINU_DELAI_MAX 32767         // Tours (Ticks)
+
+// Appelée quand la minuterie sonne (Called when the timer rings)
+typedef void (*ActionMinuterie)();
+
+template <uint8_t N>
+struct Minuteries {
+  uint16_t maintenant;               // Tour actuel (Current tick)
+  uint8_t tetes[2 * MINU_SEAUX];     // Première minuterie de chaque seau
+  uint16_t echeance[N];              // Tour où elle sonne (Tick it rings on)
+  uint16_t periode[N];               // 0 = une seule fois (0 = one-shot)
+  uint8_t suivante[N];
+  uint8_t precedente[N];
+  uint8_t seau[N];                   // MINU_AUCUNE = arrêtée (stopped)
+  ActionMinuterie action[N];
+  uint8_t sonnees[(N + 7) / 8];      // Drapeaux (Flags)
+
+  Minuteries() { minu_vider(this); }
+};
+
+// ==========================================================
+// FONCTIONS INTERNES (Internal functions)
+// ==========================================================
+
+template <uint8_t N>
+inline void minu_accrocher(Minuteries<N>* m, uint8_t id) {
+  uint16_t ecart = m->echeance[id] - m->maintenant;
+  uint8_t s;
+  if (ecart < MINU_SEAUX) {
+    s = m->echeance[id] & MINU_MASQUE;
+  } else if (ecart < MINU_SEAUX * MINU_SEAUX) {
+    s = MINU_SEAUX + ((m->echeance[id] >> MINU_BITS) & MINU_MASQUE);
+  } else {
+    // Trop loin: le dernier seau du niveau 1, replacée en passant
+    // (Too far: the last level-1 bucket, re-placed on the way)
+    s = MINU_SEAUX + (((m->maintenant >> MINU_BITS) + MINU_MASQUE) & MINU_MASQUE);
+  }
+  m->seau[id] = s;
+  m->precedente[id] = MINU_AUCUNE;
+  m->suivante[id] = m->tetes[s];
+  if (m->tetes[s] != MINU_AUCUNE) m->precedente[m->tetes[s]] = id;
+  m->tetes[s] = id;
+}
+
+template <uint8_t N>
+inline void minu_decrocher(Minuteries<N>* m, uint8_t id) {
+  uint8_t avant = m->precedente[id];
+  uint8_t apres = m->suivante[id];
+  if (avant != MINU_AUCUNE) {
+    m->suivante[avant] = apres;
+  } else {
+    m->tetes[m->seau[id]] = apres;
+  }
+  if (apres != MINU_AUCUNE) m->precedente[apres] = avant;
+  m->seau[id] = MINU_AUCUNE;
+}
+
+// ==========================================================
+// FONCTIONS DU JEU (Game functions)
+// ==========================================================
+
+// Tout arrêter, tour 0 (Stop everything, tick 0)
+template <uint8_t N>
+void minu_vider(Minuteries<N>* m) {
+  m->maintenant = 0;
+  for (uint8_t s = 0; s < 2 * MINU_SEAUX; s++) m->tetes[s] = MINU_AUCUNE;
+  for (uint8_t i = 0; i < N; i++) {
+    m->seau[i] = MINU_AUCUNE;
+    m->action[i] = nullptr;
+  }
+  for (uint8_t k = 0; k < (N + 7) / 8; k++) m->sonnees[k] = 0;
+}
+
+template <uint8_t N>
+inline bool minu_active(const Minuteries<N>* m, uint8_t id) {
+  return m->seau[id] != MINU_AUCUNE;
+}
+
+template <uint8_t N>
+inline void minu_arreter(Minuteries<N>* m, uint8_t id) {
+  if (minu_active(m, id)) minu_decrocher(m, id);
+  m->sonnees[id >> 3] &= ~(1 << (id & 7));
+}
+
+// Sonne dans "delai" tours (1 au moins), puis tous les
+// "periode" tours si periode > 0. Relancer une minuterie
+// active la repart de zéro.
+// (Rings in "delai" ticks - 1 at least - then every "periode"
+// ticks if periode > 0. Restarting an active timer starts it
+// over.)
+template <uint8_t N>
+void minu_lancer(Minuteries<N>* m, uint8_t id, uint16_t delai, uint16_t periode,
+                 ActionMinuterie action = nullptr) {
+  minu_arreter(m, id);
+  if (delai < 1) delai = 1;
+  if (delai > MINU_DELAI_MAX) delai = MINU_DELAI_MAX;
+  if (periode > MINU_DELAI_MAX) periode = MINU_DELAI_MAX;
+  m->echeance[id] = m->maintenant + delai;
+  m->periode[id] = periode;
+  m->action[id] = action;
+  minu_accrocher(m, id);
+}
+
+// A sonné depuis la dernière question? Baisse le drapeau.
+// (Rang since last asked? Lowers the flag.)
+template <uint8_t N>
+inline bool minu_sonne(Minuteries<N>* m, uint8_t id) {
+  uint8_t bit = 1 << (id & 7);
+  if (!(m->sonnees[id >> 3] & bit)) return false;
+  m->sonnees[id >> 3] &= ~bit;
+  return true;
+}
+
+// Tours avant la prochaine sonnerie, 0 si arrêtée
+// (Ticks before the next ring, 0 if stopped)
+template <uint8_t N>
+inline uint16_t minu_restant(const Minuteries<N>* m, uint8_t id) {
+  if (!minu_active(m, id)) return 0;
+  return m->echeance[id] - m->maintenant;
+}
+
+// Un tour de plus (One more tick)
+template <uint8_t N>
+void minu_avancer(Minuteries<N>* m) {
+  m->maintenant++;
+
+  // Début d'un bloc de 8 tours: le seau du niveau 1 descend
+  // (Start of an 8-tick block: the level-1 bucket moves down)
+  if ((m->maintenant & MINU_MASQUE) == 0) {
+    uint8_t s = MINU_SEAUX + ((m->maintenant >> MINU_BITS) & MINU_MASQUE);
+    uint8_t id = m->tetes[s];
+    m->tetes[s] = MINU_AUCUNE;
+    while (id != MINU_AUCUNE) {
+      uint8_t apres = m->suivante[id];
+      minu_accrocher(m, id);
+      id = apres;
+    }
+  }
+
+  // Tout le seau du tour sonne. Une à la fois: une action peut
+  // lancer ou arrêter n'importe quelle minuterie.
+  // (The whole bucket of this tick rings. One at a time: an
+  // action may start or stop any timer.)
+  uint8_t s = m->maintenant & MINU_MASQUE;
+  while (m->tetes[s] != MINU_AUCUNE) {
+    uint8_t id = m->tetes[s];
+    minu_decrocher(m, id);
+    if (m->periode[id]) {
+      m->echeance[id] += m->periode[id];
+      minu_accrocher(m, id);
+    }
+    m->sonnees[id >> 3] |= 1 << (id & 7);
+    if (m->action[id]) m->action[id]();
+  }
+}
+
+// ==========================================================
+// MINUTERIES DU JEU EN COURS (Timers of the running game)
+// ==========================================================
+// Vidées par lancerJeu(), avancées par loop() (Game.ino).
+// RAM: 2 + 16 + 9 par minuterie + 1 = 91 octets pour 8.
+// (Cleared by lancerJeu(), advanced by loop() - Game.ino.)
+
+#define MINU_MAX 8
+
+Minuteries<MINU_MAX> minu_jeu;
+
+#endif
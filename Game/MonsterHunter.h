@@ -17,6 +17,8 @@
 #include "Procedural.h"  // Pour génération procédurale!
 #include "Physics.h"     // Pour collision et distance!
 #include "Personnages.h" // Pour dessiner le joueur!
+#include "Sprites.h"     // Monstre et boss en Flash!
+#include "Entites.h"     // Monstres, tirs, nourriture!
 
 // ==========================================================
 // INFORMATIONS DU JEU (Game information)
@@ -126,31 +128,17 @@ int mh_direction = DIR_DROITE;
 int mh_derniereDirectionX = 1;
 int mh_derniereDirectionY = 0;
 
-// Position de la nourriture (Food position)
-int mh_nourritureX = 0;
-int mh_nourritureY = 0;
+// Tailles (Sizes)
 int mh_tailleNourriture = 4;
-
-// Position du monstre (Monster position)
-int mh_monstreX = 0;
-int mh_monstreY = 0;
 int mh_tailleMonstre = 8;
-int mh_tailleMonstreActuelle = 8;
 int mh_distanceMinMonstre = 40;
 
 // Configuration du Boss (Boss configuration)
-bool mh_estBoss = false;
 int mh_tailleBoss = 14;
-int mh_vieBoss = 0;
 int mh_vieMaxBoss = 5;
 int mh_bonusVitesseBoss = 2;
 
-// Position du tir (Shot position)
-int mh_tirX = 0;
-int mh_tirY = 0;
-int mh_tirDirectionX = 0;
-int mh_tirDirectionY = 0;
-bool mh_tirActif = false;
+// Tir (Shot)
 int mh_vitesseTir = 4;
 
 // Munitions (Ammo)
@@ -159,15 +147,58 @@ int mh_munitionsMax = 3;
 
 // Vitesses (Speeds)
 int mh_vitesseJoueur = 3;
-int mh_vitesseMonstre = 1;
-int mh_vitesseMonstreBase = 1;
+int mh_vitesseMonstreBase = 1;  // Le boss ajoute mh_bonusVitesseBoss
 int mh_vitesseMonstreMax = 8;
 int mh_bonusVitesseNourriture = 2;
 // Note: mh_bonusVitesseNiveau est maintenant dans PROGMEM!
 
-// Compteur monstre (Monster counter)
-int mh_compteurMonstre = 0;
-int mh_delaiMonstre = 3;
+// Le monstre avance au sous-pixel: 3 crans de vitesse = 1
+// pixel par image, au plus 1 comme avant (Physics.h, fixe 8.8)
+// (The monster moves in sub-pixels: 3 speed steps = 1 pixel
+// per frame, 1 at most as before - Physics.h, 8.8 fixed point)
+#define MH_CRAN_VITESSE (FIXE_UN / 3)
+
+// ==========================================================
+// ENTITÉS (Entities) - Entites.h
+// ==========================================================
+// Nourriture, monstres et tirs sont des entités: un octet de
+// composants chacune, et un tableau par composant. Plusieurs
+// monstres ou tirs ne demandent qu'une entité de plus.
+// (Food, monsters and shots are entities: one component byte
+// each, and one array per component. More monsters or shots
+// only need one more entity.)
+//
+// RAM: 6 entités x 12 octets = 72 octets
+// (RAM: 6 entities x 12 bytes = 72 bytes)
+
+#define MH_ENTITES 6
+
+#define MH_POSITION   ENT_COMPOSANT(0)  // mh_entX, mh_entY
+#define MH_VITESSE    ENT_COMPOSANT(1)  // mh_entVX, mh_entVY (fixe 8.8)
+#define MH_CHASSEUR   ENT_COMPOSANT(2)  // Fonce sur le joueur (Chases the player)
+#define MH_ENNEMI     ENT_COMPOSANT(3)  // Tue le joueur, cible des tirs: mh_entVie
+#define MH_BOSS       ENT_COMPOSANT(4)  // Gros, plus rapide (Big, faster)
+#define MH_TIR        ENT_COMPOSANT(5)  // Disparaît hors écran (Gone off screen)
+#define MH_NOURRITURE ENT_COMPOSANT(6)  // Recharge les munitions (Refills ammo)
+
+#define MH_MONSTRE (MH_POSITION | MH_VITESSE | MH_CHASSEUR | MH_ENNEMI)
+
+// Événements (GameBase.h): valeurs de EVT_TOUCHE, et un type à nous
+// (Events: EVT_TOUCHE values, and a type of our own)
+#define MH_TOUCHE_MONSTRE 0
+#define MH_TOUCHE_BOSS 1
+#define MH_TOUCHE_NOURRITURE 2
+#define MH_EVT_BOSS_VAINCU (EVT_JEU + 0)  // valeur = points, SANS passage de niveau
+#define MH_EVT_NOURRITURE (EVT_JEU + 1)   // valeur = points, puis le bonus de vitesse
+
+Entites<MH_ENTITES> mh_monde;
+int mh_entX[MH_ENTITES];
+int mh_entY[MH_ENTITES];
+uint8_t mh_entFractionX[MH_ENTITES];
+uint8_t mh_entFractionY[MH_ENTITES];
+fixe mh_entVX[MH_ENTITES];
+fixe mh_entVY[MH_ENTITES];
+uint8_t mh_entVie[MH_ENTITES];
 
 // Score et niveau (Score and level)
 int mh_score = 0;
@@ -184,74 +215,196 @@ int mh_etatJeu = ETAT_EN_COURS;
 int mh_spawnNourriture = 0;
 int mh_spawnMonstre = 0;
 
+// Un flux chacun: les deux compteurs avancent ensemble
+// (One stream each: both counters move together)
+#define MH_FLUX_NOURRITURE (PROC_FLUX_JEU + 1)
+#define MH_FLUX_MONSTRE (PROC_FLUX_JEU + 2)
+
 // ==========================================================
 // FONCTIONS UTILITAIRES (Utility functions)
 // ==========================================================
 // Note: mh_calculerDistance() supprimé - utilise phys_distance() de Physics.h!
 // (Note: mh_calculerDistance() removed - use phys_distance() from Physics.h!)
 
+// Distance entre la nourriture et le monstre/joueur au spawn
+// (Gap between food and monster/player when spawning)
+#define MH_ESPACEMENT_SPAWN 16
+
+// Nouvelle entité, données à zéro (New entity, zeroed data)
+uint8_t mh_creerEntite(uint8_t masque) {
+  uint8_t e = mh_monde.creer(masque);
+  if (e != ENT_AUCUNE) {
+    mh_entX[e] = 0;
+    mh_entY[e] = 0;
+    mh_entFractionX[e] = 0;
+    mh_entFractionY[e] = 0;
+    mh_entVX[e] = 0;
+    mh_entVY[e] = 0;
+    mh_entVie[e] = 1;
+  }
+  return e;
+}
+
+inline int mh_tailleEnnemi(uint8_t e) {
+  return mh_monde.a(e, MH_BOSS) ? mh_tailleBoss : mh_tailleMonstre;
+}
+
+// Le boss en cours, ENT_AUCUNE si aucun (Current boss, if any)
+inline uint8_t mh_boss() {
+  return mh_monde.premiere(MH_BOSS);
+}
+
 // Placer la nourriture au hasard (Place food randomly)
-// Utilise génération procédurale!
-void mh_placerNourriture() {
+// Utilise le spawn sans rejet: jamais sur le joueur ni un monstre!
+// (Uses rejection-free spawning: never on the player or a monster!)
+void mh_placerNourriture(uint8_t n) {
   mh_spawnNourriture++;
-  proc_genererPosition(mh_niveau * 100 + mh_spawnNourriture, 0,
-                       &mh_nourritureX, &mh_nourritureY, 10);
-  // Ajuster Y pour éviter la barre de score
-  if (mh_nourritureY < 15) mh_nourritureY = 15;
+  
+  // Zone libre: sous la barre de score, loin du joueur et des monstres
+  // (Free zone: below the score bar, away from player and monsters)
+  ProcSpawn zone;
+  proc_spawnDebut(&zone, 10, 15);
+  proc_spawnEviter(&zone, mh_joueurX, mh_joueurY, MH_ESPACEMENT_SPAWN);
+  POUR_CHAQUE_ENTITE(mh_monde, MH_ENNEMI | MH_POSITION, e) {
+    proc_spawnEviter(&zone, mh_entX[e], mh_entY[e], MH_ESPACEMENT_SPAWN);
+  }
+  
+  // Seed = niveau, index = compteur: chaque spawn a son propre sous-flux
+  // (Seed = level, index = counter: each spawn has its own sub-stream)
+  proc_spawnChoisir(&zone, mh_niveau, MH_FLUX_NOURRITURE, mh_spawnNourriture,
+                    &mh_entX[n], &mh_entY[n], 0);
 }
 
-// Placer le monstre au hasard (Place monster randomly)
-// Utilise génération procédurale - loin du joueur!
-void mh_placerMonstre() {
+// Placer un monstre au hasard (Place a monster randomly)
+// Utilise le spawn sans rejet - loin du joueur!
+void mh_placerMonstre(uint8_t m) {
   mh_spawnMonstre++;
   int distanceMin = mh_distanceMinMonstre;
   
-  if (mh_estBoss) {
+  if (mh_monde.a(m, MH_BOSS)) {
     distanceMin = mh_distanceMinMonstre + 10;
   }
   
-  // Utiliser proc_genererLoinDe pour spawner loin du joueur!
-  proc_genererLoinDe(mh_niveau * 200 + mh_spawnMonstre, 0,
-                     &mh_monstreX, &mh_monstreY,
-                     mh_joueurX, mh_joueurY, distanceMin, 10);
-  
-  // Ajuster Y pour éviter la barre de score
-  if (mh_monstreY < 12) mh_monstreY = 12;
+  // Zone libre: loin du joueur, pas sur la nourriture
+  // (Free zone: far from player, not on the food)
+  ProcSpawn zone;
+  proc_spawnDebut(&zone, 10, 12);
+  proc_spawnEviter(&zone, mh_joueurX, mh_joueurY, distanceMin);
+  POUR_CHAQUE_ENTITE(mh_monde, MH_NOURRITURE | MH_POSITION, n) {
+    proc_spawnEviter(&zone, mh_entX[n], mh_entY[n], MH_ESPACEMENT_SPAWN);
+  }
+  proc_spawnChoisir(&zone, mh_niveau, MH_FLUX_MONSTRE, mh_spawnMonstre,
+                    &mh_entX[m], &mh_entY[m], 0);
+  mh_entFractionX[m] = 0;
+  mh_entFractionY[m] = 0;
+}
+
+// Une nourriture et un monstre, comme au début
+// (One food and one monster, as at the start)
+void mh_creerEntites() {
+  mh_monde.vider();
+  uint8_t n = mh_creerEntite(MH_POSITION | MH_NOURRITURE);
+  uint8_t m = mh_creerEntite(MH_MONSTRE);
+  mh_placerNourriture(n);
+  mh_placerMonstre(m);
 }
 
 // Vérifier collision avec nourriture (Check collision with food)
 // Simplifié avec Physics.h!
-bool mh_verifierCollisionNourriture() {
+bool mh_verifierCollisionNourriture(uint8_t n) {
   int seuil = (mh_tailleJoueur + mh_tailleNourriture) / 2 + 3;
   return phys_touchePoint(mh_joueurX, mh_joueurY,
-                          mh_nourritureX, mh_nourritureY, seuil);
+                          mh_entX[n], mh_entY[n], seuil);
 }
 
-// Vérifier collision avec monstre (Check collision with monster)
-// Simplifié avec Physics.h!
-bool mh_verifierCollisionMonstre() {
-  int seuil = (mh_tailleJoueur + mh_tailleMonstreActuelle) / 2 + 2;
-  return phys_touchePoint(mh_joueurX, mh_joueurY,
-                          mh_monstreX, mh_monstreY, seuil);
+// Le monstre regarde le joueur: 2 images par direction dans
+// Sprites.h (droite, gauche, bas, haut)
+// (The monster faces the player: 2 frames per direction in
+// Sprites.h - right, left, down, up)
+uint8_t mh_imageMonstre(uint8_t m) {
+  int diffX = mh_joueurX - mh_entX[m];
+  int diffY = mh_joueurY - mh_entY[m];
+  int absDiffX = diffX < 0 ? -diffX : diffX;
+  int absDiffY = diffY < 0 ? -diffY : diffY;
+
+  if (absDiffX > absDiffY) {
+    return diffX > 0 ? 0 : 2;
+  }
+  return diffY > 0 ? 4 : 6;
+}
+
+inline const Sprite* mh_spriteMonstre(uint8_t m) {
+  return mh_monde.a(m, MH_BOSS) ? &spr_boss : &spr_monstre;
+}
+
+// Vérifier collision avec un monstre (Check collision with a monster)
+// Au pixel près: le triangle contre le dessin du joueur (épée comprise)
+// (Pixel-perfect: the triangle against the player's picture, sword included)
+bool mh_verifierCollisionMonstre(uint8_t m) {
+  return pers_toucheVueHaut(mh_joueurX, mh_joueurY, mh_tailleJoueur,
+                            personnageActuel, mh_direction,
+                            mh_entX[m], mh_entY[m], mh_spriteMonstre(m), mh_imageMonstre(m));
 }
 
 // Vérifier collision tir-monstre (Check shot-monster collision)
 // Simplifié avec Physics.h!
-bool mh_verifierCollisionTirMonstre() {
-  int centreMX = mh_monstreX + mh_tailleMonstreActuelle / 2;
-  int centreMY = mh_monstreY + mh_tailleMonstreActuelle / 2;
-  int seuil = mh_tailleMonstreActuelle / 2 + 2;
-  return phys_touchePoint(mh_tirX, mh_tirY, centreMX, centreMY, seuil);
+bool mh_verifierCollisionTirMonstre(uint8_t t, uint8_t m) {
+  int taille = mh_tailleEnnemi(m);
+  int centreMX = mh_entX[m] + taille / 2;
+  int centreMY = mh_entY[m] + taille / 2;
+  int seuil = taille / 2 + 2;
+  return phys_touchePoint(mh_entX[t], mh_entY[t], centreMX, centreMY, seuil);
+}
+
+// ----------------------------------------------------------
+// Systèmes: une boucle par masque de composants
+// (Systems: one loop per component mask)
+// ----------------------------------------------------------
+
+// Chasseurs: vitesse tout droit vers le joueur, au sous-pixel
+// (Chasers: velocity straight at the player, in sub-pixels)
+void mh_systemeChasse() {
+  POUR_CHAQUE_ENTITE(mh_monde, MH_CHASSEUR | MH_VITESSE | MH_POSITION, m) {
+    int dx = mh_joueurX - mh_entX[m];
+    int dy = mh_joueurY - mh_entY[m];
+    if (dx == 0 && dy == 0) {
+      mh_entVX[m] = 0;
+      mh_entVY[m] = 0;
+      continue;
+    }
+    
+    int crans = mh_vitesseMonstreBase;
+    if (mh_monde.a(m, MH_BOSS)) crans = crans + mh_bonusVitesseBoss;
+    fixe vitesse = crans * MH_CRAN_VITESSE;
+    if (vitesse > FIXE_UN) vitesse = FIXE_UN;
+    
+    phys_vitesseAngle(phys_angle(dx, dy), vitesse, &mh_entVX[m], &mh_entVY[m]);
+  }
+}
+
+// Tout ce qui a une vitesse avance (Everything with a velocity moves)
+void mh_systemeMouvement() {
+  POUR_CHAQUE_ENTITE(mh_monde, MH_VITESSE | MH_POSITION, e) {
+    phys_avancerFixe(&mh_entX[e], &mh_entFractionX[e], mh_entVX[e]);
+    phys_avancerFixe(&mh_entY[e], &mh_entFractionY[e], mh_entVY[e]);
+  }
 }
 
-// Activer le mode boss (Activate boss mode)
+// Placer le boss: fait PENDANT l'alerte (Place the boss: done DURING the alert)
+bool mh_tranchePlacerBoss() {
+  uint8_t boss = mh_boss();
+  if (boss != ENT_AUCUNE) mh_placerMonstre(boss);
+  return false;  // Fini en une tranche (Done in one slice)
+}
+
+// Activer le mode boss: le premier monstre devient le boss
+// (Activate boss mode: the first monster becomes the boss)
 void mh_activerBoss() {
-  mh_estBoss = true;
-  mh_vieBoss = mh_getVieBossNiveau(mh_niveau);  // Vie depuis PROGMEM!
-  mh_vieMaxBoss = mh_vieBoss;
-  mh_tailleMonstreActuelle = mh_tailleBoss;
-  mh_vitesseMonstre = mh_vitesseMonstreBase + mh_bonusVitesseBoss;
-  mh_placerMonstre();
+  uint8_t boss = mh_monde.premiere(MH_ENNEMI);
+  if (boss == ENT_AUCUNE) return;
+  mh_monde.ajouter(boss, MH_BOSS);
+  mh_vieMaxBoss = mh_getVieBossNiveau(mh_niveau);  // Vie depuis PROGMEM!
+  mh_entVie[boss] = mh_vieMaxBoss;
   
   // Afficher alerte BOSS (Show BOSS alert)
   // Note: Utilise DESSINER_ECRAN pour le mode page buffer
@@ -262,8 +415,8 @@ void mh_activerBoss() {
     ecrireTexte(15, 48, pm_lireTexte(mh_txtTire5Fois), 1);
   }
   
-  melodieAlerteBoss();
-  delay(1500);
+  melodieAlerteBoss();  // Même tour: après la fanfare (Same tick: after the fanfare)
+  attendreEnTravaillant(1500, mh_tranchePlacerBoss);
 }
 
 // Vérifier et mettre à jour le niveau (Check and update level)
@@ -284,65 +437,22 @@ void mh_verifierNiveau() {
   if (nouveauNiveau > mh_niveau) {
     mh_niveau = nouveauNiveau;
     // Vitesse depuis PROGMEM!
-    mh_vitesseMonstre = mh_getVitesseNiveau(mh_niveau);
-    mh_vitesseMonstreBase = mh_vitesseMonstre;
+    mh_vitesseMonstreBase = mh_getVitesseNiveau(mh_niveau);
     
-    melodieNiveauSup();
-    mh_activerBoss();
+    // Traité dans le même tour: son + alerte boss
+    // (Handled in the same tick: sound + boss alert)
+    evt_poster(EVT_NIVEAU, mh_niveau);
   }
 }
 
-// Dessiner le monstre triangle (Draw triangle monster)
-void mh_dessinerMonstre() {
-  int pointeX = mh_monstreX;
-  int pointeY = mh_monstreY;
-  int base1X = mh_monstreX;
-  int base1Y = mh_monstreY;
-  int base2X = mh_monstreX;
-  int base2Y = mh_monstreY;
-  
-  int diffX = mh_joueurX - mh_monstreX;
-  int diffY = mh_joueurY - mh_monstreY;
-  int absDiffX = diffX < 0 ? -diffX : diffX;
-  int absDiffY = diffY < 0 ? -diffY : diffY;
-  
-  int taille = mh_tailleMonstreActuelle;
-  
-  if (absDiffX > absDiffY) {
-    if (diffX > 0) {
-      pointeX = mh_monstreX + taille;
-      pointeY = mh_monstreY + taille / 2;
-      base1X = mh_monstreX;
-      base1Y = mh_monstreY;
-      base2X = mh_monstreX;
-      base2Y = mh_monstreY + taille;
-    } else {
-      pointeX = mh_monstreX;
-      pointeY = mh_monstreY + taille / 2;
-      base1X = mh_monstreX + taille;
-      base1Y = mh_monstreY;
-      base2X = mh_monstreX + taille;
-      base2Y = mh_monstreY + taille;
-    }
-  } else {
-    if (diffY > 0) {
-      pointeX = mh_monstreX + taille / 2;
-      pointeY = mh_monstreY + taille;
-      base1X = mh_monstreX;
-      base1Y = mh_monstreY;
-      base2X = mh_monstreX + taille;
-      base2Y = mh_monstreY;
-    } else {
-      pointeX = mh_monstreX + taille / 2;
-      pointeY = mh_monstreY;
-      base1X = mh_monstreX;
-      base1Y = mh_monstreY + taille;
-      base2X = mh_monstreX + taille;
-      base2Y = mh_monstreY + taille;
-    }
-  }
-  
-  dessinerTriangle(pointeX, pointeY, base1X, base1Y, base2X, base2Y);
+// Clignement: images 0 (yeux ouverts) puis 1 (fermés), 256ms chacune
+// (Blink: frames 0 (eyes open) then 1 (closed), 256ms each)
+ANIMATION_PROGMEM(mh_animClignement, 2, 0, 0, 0, 0, 0, 0, 0, 1);
+
+// Dessiner un monstre triangle (Draw a triangle monster)
+void mh_dessinerMonstre(uint8_t m) {
+  uint8_t image = mh_imageMonstre(m) + imageAnimation(mh_animClignement, millis() >> 6);
+  dessinerSprite(mh_entX[m], mh_entY[m], mh_spriteMonstre(m), image);
 }
 
 // Buffer pour la barre de statut (Status bar buffer)
@@ -350,10 +460,16 @@ char mh_statusBuffer[32];
 
 // Dessiner le contenu du jeu (Draw game content) - appelé dans la boucle page
 void mh_dessinerContenu() {
+  // Cailloux sur le sol, différents à chaque niveau
+  // (Pebbles on the ground, different on every level)
+  proc_fondPage(tamponPage(), numeroPage(), proc_bruitGraine(mh_niveau, PROC_FLUX_JEU),
+                0, 0, 50, 11, 63);
+  
   // Score et niveau en haut (Score and level at top)
   // Format: "Nv:X XXXp Tir:X" ou avec boss
-  if (mh_estBoss) {
-    sprintf(mh_statusBuffer, "Nv:%d %dp B:%d/%d", mh_niveau, mh_score, mh_vieBoss, mh_vieMaxBoss);
+  uint8_t boss = mh_boss();
+  if (boss != ENT_AUCUNE) {
+    sprintf(mh_statusBuffer, "Nv:%d %dp B:%d/%d", mh_niveau, mh_score, mh_entVie[boss], mh_vieMaxBoss);
   } else {
     sprintf(mh_statusBuffer, "Nv:%d %dp Tir:%d", mh_niveau, mh_score, mh_munitions);
   }
@@ -368,15 +484,19 @@ void mh_dessinerContenu() {
                        personnageActuel, mh_direction);
   
   // Nourriture (Food)
-  dessinerCercle(mh_nourritureX, mh_nourritureY, mh_tailleNourriture / 2);
+  POUR_CHAQUE_ENTITE(mh_monde, MH_NOURRITURE | MH_POSITION, n) {
+    dessinerCercle(mh_entX[n], mh_entY[n], mh_tailleNourriture / 2);
+  }
   
-  // Tir (Shot)
-  if (mh_tirActif) {
-    dessinerRectangle(mh_tirX, mh_tirY, 2, 2);
+  // Tirs (Shots)
+  POUR_CHAQUE_ENTITE(mh_monde, MH_TIR | MH_POSITION, t) {
+    dessinerRectangle(mh_entX[t], mh_entY[t], 2, 2);
   }
   
-  // Monstre (Monster)
-  mh_dessinerMonstre();
+  // Monstres (Monsters)
+  POUR_CHAQUE_ENTITE(mh_monde, MH_ENNEMI | MH_POSITION, m) {
+    mh_dessinerMonstre(m);
+  }
 }
 
 // Dessiner le jeu (Draw the game)
@@ -388,8 +508,6 @@ void mh_dessinerJeu() {
 
 // Fin du jeu (Game over)
 void mh_finDuJeu() {
-  mh_etatJeu = ETAT_TERMINE;
-  
   melodieGameOver();
   
   DESSINER_ECRAN {
@@ -405,6 +523,45 @@ void mh_finDuJeu() {
   }
 }
 
+// ==========================================================
+// ÉVÉNEMENTS (Events) - traités par Game.ino après le dessin
+// (Handled by Game.ino after drawing)
+// ==========================================================
+// Les points arrivent ici, donc le passage de niveau aussi.
+// (Points arrive here, so levelling up does too.)
+
+void mh_traiterEvenement(const Evenement* e) {
+  if (e->type == EVT_POINTS) {
+    mh_score = mh_score + e->valeur;
+    mh_verifierNiveau();
+  } else if (e->type == EVT_TOUCHE) {
+    if (e->valeur == MH_TOUCHE_MONSTRE) melodieMonstreTouche();
+    else if (e->valeur == MH_TOUCHE_BOSS) melodieBossTouche();
+    else melodieRecharge();
+  } else if (e->type == MH_EVT_NOURRITURE) {
+    // Le niveau d'abord, le bonus ensuite: la vitesse du nouveau
+    // niveau garde le bonus, plafonné avec le nouveau niveau
+    // (Level first, bonus after: the new level's speed keeps the
+    // bonus, capped with the new level)
+    mh_score = mh_score + e->valeur;
+    mh_verifierNiveau();
+    mh_vitesseMonstreBase = mh_vitesseMonstreBase + mh_bonusVitesseNourriture;
+    int vitesseMax = mh_vitesseMonstreMax + (mh_niveau - 1) * 2;
+    if (mh_vitesseMonstreBase > vitesseMax) mh_vitesseMonstreBase = vitesseMax;
+  } else if (e->type == MH_EVT_BOSS_VAINCU) {
+    // Comme toujours: les points du boss ne font pas monter de
+    // niveau, le prochain monstre s'en charge
+    // (As always: boss points do not level up, the next monster does)
+    mh_score = mh_score + e->valeur;
+    melodieVictoireBoss();
+  } else if (e->type == EVT_NIVEAU) {
+    melodieNiveauSup();
+    mh_activerBoss();
+  } else if (e->type == EVT_FIN) {
+    mh_finDuJeu();
+  }
+}
+
 // ==========================================================
 // FONCTIONS PRINCIPALES DU JEU (Main game functions)
 // ==========================================================
@@ -420,11 +577,10 @@ void mh_setupJeu() {
   afficherEcran();
   
   melodieStartup();
-  delay(2500);
+  patienter(2500);
   
   // Placer nourriture et monstre (Place food and monster)
-  mh_placerNourriture();
-  mh_placerMonstre();
+  mh_creerEntites();
   
   mh_etatJeu = ETAT_EN_COURS;
 }
@@ -440,20 +596,13 @@ void mh_resetJeu() {
   mh_niveau = 1;
   mh_monstresTues = 0;
   mh_bossTues = 0;
-  mh_vitesseMonstre = 1;
   mh_vitesseMonstreBase = 1;
-  mh_compteurMonstre = 0;
-  mh_tirActif = false;
   mh_munitions = mh_munitionsMax;
-  mh_estBoss = false;
-  mh_vieBoss = 0;
-  mh_tailleMonstreActuelle = mh_tailleMonstre;
   mh_etatJeu = ETAT_EN_COURS;
   mh_spawnNourriture = 0;
   mh_spawnMonstre = 0;
   
-  mh_placerNourriture();
-  mh_placerMonstre();
+  mh_creerEntites();
   
   melodieRestart();
 }
@@ -505,100 +654,90 @@ void mh_loopJeu() {
   if (mh_joueurY > HAUTEUR_ECRAN - mh_tailleJoueur) mh_joueurY = HAUTEUR_ECRAN - mh_tailleJoueur;
   
   // ===== TIR DU JOUEUR (PLAYER SHOOTING) =====
-  if (boutonJustePresse() && !mh_tirActif) {
+  // Un tir à la fois (One shot at a time)
+  if (boutonJustePresse() && mh_monde.premiere(MH_TIR) == ENT_AUCUNE) {
     if (mh_munitions > 0) {
-      mh_tirActif = true;
-      mh_tirX = mh_joueurX + mh_tailleJoueur / 2;
-      mh_tirY = mh_joueurY + mh_tailleJoueur / 2;
-      mh_tirDirectionX = mh_derniereDirectionX;
-      mh_tirDirectionY = mh_derniereDirectionY;
-      mh_munitions = mh_munitions - 1;
-      melodieTir();
+      uint8_t t = mh_creerEntite(MH_POSITION | MH_VITESSE | MH_TIR);
+      if (t != ENT_AUCUNE) {
+        mh_entX[t] = mh_joueurX + mh_tailleJoueur / 2;
+        mh_entY[t] = mh_joueurY + mh_tailleJoueur / 2;
+        mh_entVX[t] = mh_derniereDirectionX * mh_vitesseTir * FIXE_UN;
+        mh_entVY[t] = mh_derniereDirectionY * mh_vitesseTir * FIXE_UN;
+        mh_munitions = mh_munitions - 1;
+        melodieTir();
+      }
     } else {
       melodiePasDeMunitions();
     }
   }
   
-  // Déplacer le tir (Move the shot)
-  if (mh_tirActif) {
-    mh_tirX = mh_tirX + mh_tirDirectionX * mh_vitesseTir;
-    mh_tirY = mh_tirY + mh_tirDirectionY * mh_vitesseTir;
-    
+  // ===== MOUVEMENT (MOVEMENT) =====
+  // Monstres tout droit vers le joueur au sous-pixel, tirs en
+  // ligne droite (Physics.h) - (Monsters straight at the
+  // player in sub-pixels, shots in a straight line)
+  mh_systemeChasse();
+  mh_systemeMouvement();
+  
+  // ===== TIRS (SHOTS) =====
+  POUR_CHAQUE_ENTITE(mh_monde, MH_TIR | MH_POSITION, t) {
     // Vérifier si hors écran (Check if off screen)
-    if (mh_tirX < 0 || mh_tirX > LARGEUR_ECRAN || mh_tirY < 10 || mh_tirY > HAUTEUR_ECRAN) {
-      mh_tirActif = false;
+    if (mh_entX[t] < 0 || mh_entX[t] > LARGEUR_ECRAN || mh_entY[t] < 10 || mh_entY[t] > HAUTEUR_ECRAN) {
+      mh_monde.detruire(t);
+      continue;
     }
     
-    // Vérifier collision avec monstre (Check collision with monster)
-    if (mh_verifierCollisionTirMonstre()) {
-      mh_tirActif = false;
+    // Vérifier collision avec les monstres (Check collision with monsters)
+    POUR_CHAQUE_ENTITE(mh_monde, MH_ENNEMI | MH_POSITION, m) {
+      if (!mh_verifierCollisionTirMonstre(t, m)) continue;
+      mh_monde.detruire(t);
+      mh_entVie[m] = mh_entVie[m] - 1;
       
-      if (mh_estBoss) {
-        mh_vieBoss = mh_vieBoss - 1;
-        melodieBossTouche();
+      if (mh_monde.a(m, MH_BOSS)) {
+        evt_poster(EVT_TOUCHE, MH_TOUCHE_BOSS);
         
-        if (mh_vieBoss <= 0) {
+        if (mh_entVie[m] == 0) {
           mh_bossTues = mh_bossTues + 1;
           mh_monstresTues = mh_monstresTues + 1;
-          mh_score = mh_score + 50;
-          melodieVictoireBoss();
+          evt_poster(MH_EVT_BOSS_VAINCU, 50);
           
-          mh_estBoss = false;
-          mh_tailleMonstreActuelle = mh_tailleMonstre;
-          mh_vitesseMonstre = mh_vitesseMonstreBase;
-          mh_placerMonstre();
+          // Le boss redevient un monstre normal (The boss turns back into a normal monster)
+          mh_monde.retirer(m, MH_BOSS);
+          mh_entVie[m] = 1;
+          mh_placerMonstre(m);
         }
       } else {
         mh_monstresTues = mh_monstresTues + 1;
-        mh_score = mh_score + 25;
-        melodieMonstreTouche();
-        mh_verifierNiveau();
-        mh_placerMonstre();
+        evt_poster(EVT_TOUCHE, MH_TOUCHE_MONSTRE);
+        evt_poster(EVT_POINTS, 25);
+        mh_entVie[m] = 1;
+        mh_placerMonstre(m);
         // Vitesse depuis PROGMEM!
-        mh_vitesseMonstre = mh_getVitesseNiveau(mh_niveau);
-        mh_vitesseMonstreBase = mh_vitesseMonstre;
+        mh_vitesseMonstreBase = mh_getVitesseNiveau(mh_niveau);
       }
+      break;
     }
   }
   
-  // ===== MOUVEMENT DU MONSTRE (MONSTER MOVEMENT) =====
-  // Simplifié avec Physics.h!
-  mh_compteurMonstre = mh_compteurMonstre + mh_vitesseMonstre;
-  
-  if (mh_compteurMonstre >= mh_delaiMonstre) {
-    mh_compteurMonstre = 0;
-    // Utilise phys_bougerVers pour suivre le joueur!
-    phys_bougerVers(&mh_monstreX, &mh_monstreY, mh_joueurX, mh_joueurY, 1);
-  }
-  
   // Vérifier collision avec nourriture (Check collision with food)
-  if (mh_verifierCollisionNourriture()) {
-    mh_score = mh_score + 10;
+  POUR_CHAQUE_ENTITE(mh_monde, MH_NOURRITURE | MH_POSITION, n) {
+    if (!mh_verifierCollisionNourriture(n)) continue;
     mh_munitions = mh_munitionsMax;
-    melodieRecharge();
-    mh_verifierNiveau();
-    mh_placerNourriture();
-    
-    mh_vitesseMonstre = mh_vitesseMonstre + mh_bonusVitesseNourriture;
-    int vitesseMax = mh_vitesseMonstreMax + (mh_niveau - 1) * 2;
-    if (mh_vitesseMonstre > vitesseMax) mh_vitesseMonstre = vitesseMax;
-    mh_vitesseMonstreBase = mh_vitesseMonstre;
-    
-    if (mh_estBoss) {
-      mh_vitesseMonstre = mh_vitesseMonstreBase + mh_bonusVitesseBoss;
-    }
+    evt_poster(EVT_TOUCHE, MH_TOUCHE_NOURRITURE);
+    evt_poster(MH_EVT_NOURRITURE, 10);  // Points et vitesse (Points and speed)
+    mh_placerNourriture(n);
   }
   
-  // Vérifier collision avec monstre (Check collision with monster)
-  if (mh_verifierCollisionMonstre()) {
-    mh_finDuJeu();
-    return;
+  // Vérifier collision avec les monstres (Check collision with monsters)
+  POUR_CHAQUE_ENTITE(mh_monde, MH_ENNEMI | MH_POSITION, m) {
+    if (mh_verifierCollisionMonstre(m)) {
+      mh_etatJeu = ETAT_TERMINE;
+      evt_poster(EVT_FIN);
+      return;
+    }
   }
   
   // Dessiner le jeu (Draw the game)
   mh_dessinerJeu();
-  
-  delay(30);
 }
 
 // Obtenir l'état du jeu (Get game state)
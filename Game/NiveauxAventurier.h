@@ -0,0 +1,68 @@
+// ==========================================================
+// NIVEAUXAVENTURIER.H - Niveaux (Levels)
+// ==========================================================
+// Généré par tools/assets/assets.py depuis assets/ (make assets)
+// - ne pas modifier! (Generated from assets/ - do not edit!)
+// ==========================================================
+
+#ifndef NIVEAUXAVENTURIER_H
+#define NIVEAUXAVENTURIER_H
+
+#include "ProgMem.h"
+
+// Plateformes {x, y, largeur} et porte {x, y} de chaque carte
+// (Platforms and door of each map)
+
+// aventurier1.txt (5 plateformes)
+PLATEFORMES_PROGMEM(av_niv1_plat, {
+  { 0, 56, 40 },
+  { 44, 46, 32 },
+  { 80, 38, 32 },
+  { 52, 28, 32 },
+  { 96, 18, 32 }
+});
+const uint8_t av_niv1_porte[] PROGMEM = { 112, 4 };
+
+// aventurier2.txt (5 plateformes)
+PLATEFORMES_PROGMEM(av_niv2_plat, {
+  { 0, 56, 40 },
+  { 36, 46, 24 },
+  { 64, 36, 28 },
+  { 96, 26, 32 },
+  { 60, 16, 36 }
+});
+const uint8_t av_niv2_porte[] PROGMEM = { 76, 2 };
+
+// aventurier3.txt (5 plateformes)
+PLATEFORMES_PROGMEM(av_niv3_plat, {
+  { 0, 56, 40 },
+  { 32, 44, 20 },
+  { 60, 54, 24 },
+  { 92, 42, 20 },
+  { 56, 28, 24 }
+});
+const uint8_t av_niv3_porte[] PROGMEM = { 80, 14 };
+
+// aventurier4.txt (5 plateformes)
+PLATEFORMES_PROGMEM(av_niv4_plat, {
+  { 0, 56, 40 },
+  { 28, 48, 20 },
+  { 56, 38, 16 },
+  { 84, 48, 16 },
+  { 104, 36, 24 }
+});
+const uint8_t av_niv4_porte[] PROGMEM = { 116, 22 };
+
+// aventurier5.txt (5 plateformes)
+PLATEFORMES_PROGMEM(av_niv5_plat, {
+  { 0, 56, 40 },
+  { 36, 46, 20 },
+  { 64, 36, 24 },
+  { 96, 46, 20 },
+  { 72, 24, 32 }
+});
+const uint8_t av_niv5_porte[] PROGMEM = { 84, 10 };
+
+#define AV_NIV_NB_NIVEAUX 5
+
+#endif
@@ -12,6 +12,7 @@
 
 #include "Physics.h"
 #include "Procedural.h"
+#include "ProgMem.h"
 
 // ==========================================================
 // CONFIGURATION (Configuration)
@@ -111,14 +112,25 @@ inline int obj_creer(ObjetSimple* pool, int taille,
 }
 
 // Créer à position procédurale (Create at procedural position)
-// Utilise Procedural.h pour générer la position
+// Utilise le spawn sans rejet de Procedural.h: le nouvel objet
+// reste à PROC_SPAWN_ESPACEMENT des objets déjà actifs.
+// (Uses Procedural.h rejection-free spawning: the new object
+// stays PROC_SPAWN_ESPACEMENT away from active objects.)
 // Pour collectibles simples (largeur = 0)
 inline int obj_creerProc(ObjetSimple* pool, int taille,
-                         int seed, int index, int type, int marge) {
+                         int seed, uint8_t flux, int index, int type, int marge) {
   int slot = obj_trouverLibre(pool, taille);
   if (slot >= 0) {
+    ProcSpawn zone;
+    proc_spawnDebut(&zone, marge, marge);
+    for (int i = 0; i < taille; i++) {
+      if (pool[i].actif) {
+        proc_spawnEviter(&zone, pool[i].x, pool[i].y, PROC_SPAWN_ESPACEMENT);
+      }
+    }
+    
     int px, py;
-    proc_genererPosition(seed, index, &px, &py, marge);
+    proc_spawnChoisir(&zone, seed, flux, index, &px, &py, 0);
     pool[slot].x = px;
     pool[slot].y = py;
     pool[slot].largeur = 0;
@@ -282,6 +294,288 @@ inline int objm_touchePoint(ObjetMobile* pool, int taille,
   return -1;
 }
 
+// ----------------------------------------------------------
+// Rangement en colonnes (Struct-of-arrays storage)
+// ----------------------------------------------------------
+// MobilesSoA<N>: les mêmes champs que ObjetMobile, mais un
+// tableau par champ. objm_bougerTous ne lit alors que x, y,
+// vx, vy et actif, l'un après l'autre, sans sauter par-dessus
+// largeur/param/type. Même taille en RAM que ObjetMobile[N].
+// Les boucles de mouvement n'ont pas de "if": la vitesse est
+// masquée par actif (0 ou 0xFF), donc le compilateur PC peut
+// les vectoriser.
+// (Same fields as ObjetMobile, but one array per field.
+// objm_bougerTous then only reads x, y, vx, vy and actif, one
+// after the other, without jumping over largeur/param/type.
+// Same RAM as ObjetMobile[N]. Movement loops have no "if": the
+// speed is masked by actif - 0 or 0xFF - so the host compiler
+// can vectorize them.)
+//
+//   MobilesSoA<6> ennemis;
+//   objm_creer(&ennemis, 10, 20, 1, 0, 4, 3, 1);
+//   objm_bougerTous(&ennemis, 8);
+//   if (ennemis.actif[i]) dessinerPixel(ennemis.x[i], ennemis.y[i]);
+
+template <uint16_t N>
+struct MobilesSoA {
+  int8_t x[N];
+  int8_t y[N];
+  int8_t vx[N];
+  int8_t vy[N];
+  int8_t largeur[N];
+  int8_t param[N];
+  int8_t type[N];
+  uint8_t actif[N];  // 0 ou 1, pour les calculs sans "if" (0 or 1, for branchless math)
+};
+
+template <uint16_t N>
+inline void objm_initialiser(MobilesSoA<N>* pool) {
+  memset(pool, 0, sizeof(*pool));
+}
+
+template <uint16_t N>
+inline int objm_trouverLibre(MobilesSoA<N>* pool) {
+  for (uint16_t i = 0; i < N; i++) {
+    if (!pool->actif[i]) return i;
+  }
+  return -1;
+}
+
+template <uint16_t N>
+inline int objm_creer(MobilesSoA<N>* pool, int x, int y, int vx, int vy,
+                      int largeur, int param, int type) {
+  int index = objm_trouverLibre(pool);
+  if (index >= 0) {
+    pool->x[index] = x;
+    pool->y[index] = y;
+    pool->vx[index] = vx;
+    pool->vy[index] = vy;
+    pool->largeur[index] = largeur;
+    pool->param[index] = param;
+    pool->type[index] = type;
+    pool->actif[index] = 1;
+  }
+  return index;
+}
+
+template <uint16_t N>
+inline void objm_supprimer(MobilesSoA<N>* pool, int index) {
+  pool->actif[index] = 0;
+  pool->type[index] = 0;
+}
+
+template <uint16_t N>
+inline void objm_supprimerTous(MobilesSoA<N>* pool) {
+  objm_initialiser(pool);
+}
+
+// Trois passes: x, y, puis hors écran (Three passes: x, y, then off screen)
+template <uint16_t N>
+inline void objm_bougerTous(MobilesSoA<N>* pool, int marge) {
+  for (uint16_t i = 0; i < N; i++) pool->x[i] = pool->x[i] + (pool->vx[i] & -pool->actif[i]);
+  for (uint16_t i = 0; i < N; i++) pool->y[i] = pool->y[i] + (pool->vy[i] & -pool->actif[i]);
+  for (uint16_t i = 0; i < N; i++) {
+    int x = pool->x[i];
+    int y = pool->y[i];
+    uint8_t dedans = (x >= -marge) & (x <= 128 + marge) & (y >= -marge) & (y <= 64 + marge);
+    pool->actif[i] &= dedans;
+  }
+}
+
+// Un pas de 1 vers la cible: (x < cible) - (x > cible) vaut -1, 0 ou 1.
+// Tout en int8_t: 16 objets par instruction sur PC.
+// (One step toward the target: -1, 0 or 1. All in int8_t:
+// 16 objects per instruction on the host.)
+template <uint16_t N>
+inline void objm_bougerVersCible(MobilesSoA<N>* pool, int cibleX, int cibleY) {
+  int8_t cx = phys_clamp(cibleX, -128, 127);
+  int8_t cy = phys_clamp(cibleY, -128, 127);
+  for (uint16_t i = 0; i < N; i++) {
+    int8_t x = pool->x[i];
+    int8_t pas = (int8_t)((x < cx) - (x > cx));
+    pool->x[i] = x + (pas & (int8_t)-pool->actif[i]);
+  }
+  for (uint16_t i = 0; i < N; i++) {
+    int8_t y = pool->y[i];
+    int8_t pas = (int8_t)((y < cy) - (y > cy));
+    pool->y[i] = y + (pas & (int8_t)-pool->actif[i]);
+  }
+}
+
+template <uint16_t N>
+inline int objm_touchePoint(MobilesSoA<N>* pool, int x, int y, int distance) {
+  for (uint16_t i = 0; i < N; i++) {
+    if (pool->actif[i] && phys_touchePoint(pool->x[i], pool->y[i], x, y, distance)) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+// ==========================================================
+// GRILLE SPATIALE (Spatial grid)
+// ==========================================================
+// L'écran coupé en 16 x 8 cases de 8 x 8 pixels. Chaque case
+// connaît la liste des objets dont le point (x, y) est dedans.
+// Une recherche ne regarde que les cases autour du point, au
+// lieu de tout le pool: obj_touchePool passe de n x m tests à
+// environ n x (voisins).
+// (The screen cut into 16 x 8 cells of 8 x 8 pixels. Each cell
+// knows the list of objects whose (x, y) point is inside. A
+// query only looks at the cells around the point instead of
+// the whole pool.)
+//
+// RAM: 128 octets (une tête par case) + 2 par objet
+// (suivant + case). Grille<16> = 160 octets, Grille<64> = 256.
+// (RAM: 128 bytes - one head per cell - + 2 per object.)
+//
+// Objets hors écran: rangés dans la case du bord la plus
+// proche, les réponses restent exactes.
+// (Off-screen objects go in the nearest edge cell; answers stay
+// exact.)
+//
+// Les réponses sont les MÊMES que obj_touchePoint /
+// obj_touchePool: le plus petit index qui touche.
+// (Answers are the SAME as the linear versions: the lowest
+// index that hits.)
+//
+//   Grille<MAX_BALLES> grilleBalles;
+//   grille_construire(&grilleBalles, balles, MAX_BALLES);  // chaque tic
+//   int j;
+//   int e = grille_touchePool(&grilleBalles, balles, ennemis, MAX_ENNEMIS, 4, &j);
+
+#define GRILLE_COLONNES 16
+#define GRILLE_LIGNES 8
+#define GRILLE_DECALAGE 3  // Case de 8 pixels = x >> 3 (8-pixel cell)
+#define GRILLE_VIDE 0xFF
+
+// N: 254 objets maximum (0xFF = vide) (254 objects max)
+template <uint8_t N>
+struct Grille {
+  uint8_t tete[GRILLE_COLONNES * GRILLE_LIGNES];  // Premier objet de la case
+  uint8_t suivant[N];                              // Objet suivant, même case
+  uint8_t caseDe[N];                               // Case de l'objet, ou VIDE
+};
+
+// Position et état, quel que soit le pool (Position and state, any pool)
+inline int grille_posX(const ObjetSimple* pool, uint8_t i) { return pool[i].x; }
+inline int grille_posY(const ObjetSimple* pool, uint8_t i) { return pool[i].y; }
+inline bool grille_actif(const ObjetSimple* pool, uint8_t i) { return pool[i].actif; }
+inline int grille_posX(const ObjetMobile* pool, uint8_t i) { return pool[i].x; }
+inline int grille_posY(const ObjetMobile* pool, uint8_t i) { return pool[i].y; }
+inline bool grille_actif(const ObjetMobile* pool, uint8_t i) { return pool[i].actif; }
+template <uint16_t M>
+inline int grille_posX(const MobilesSoA<M>* pool, uint8_t i) { return pool->x[i]; }
+template <uint16_t M>
+inline int grille_posY(const MobilesSoA<M>* pool, uint8_t i) { return pool->y[i]; }
+template <uint16_t M>
+inline bool grille_actif(const MobilesSoA<M>* pool, uint8_t i) { return pool->actif[i]; }
+
+inline uint8_t grille_colonne(int x) {
+  return phys_clamp(x >> GRILLE_DECALAGE, 0, GRILLE_COLONNES - 1);
+}
+
+inline uint8_t grille_ligne(int y) {
+  return phys_clamp(y >> GRILLE_DECALAGE, 0, GRILLE_LIGNES - 1);
+}
+
+template <uint8_t N>
+inline void grille_vider(Grille<N>* g) {
+  memset(g->tete, GRILLE_VIDE, sizeof(g->tete));
+  memset(g->caseDe, GRILLE_VIDE, sizeof(g->caseDe));
+}
+
+// Retirer l'objet i de sa case (Remove object i from its cell)
+template <uint8_t N>
+inline void grille_retirer(Grille<N>* g, uint8_t i) {
+  uint8_t c = g->caseDe[i];
+  if (c == GRILLE_VIDE) return;
+  uint8_t* lien = &g->tete[c];
+  while (*lien != i) lien = &g->suivant[*lien];
+  *lien = g->suivant[i];
+  g->caseDe[i] = GRILLE_VIDE;
+}
+
+// Mettre l'objet i à (x, y): rien à faire s'il reste dans sa case
+// (Put object i at (x, y): nothing to do if it stays in its cell)
+template <uint8_t N>
+inline void grille_placer(Grille<N>* g, uint8_t i, int x, int y) {
+  uint8_t c = grille_ligne(y) * GRILLE_COLONNES + grille_colonne(x);
+  if (g->caseDe[i] == c) return;
+  grille_retirer(g, i);
+  g->suivant[i] = g->tete[c];
+  g->tete[c] = i;
+  g->caseDe[i] = c;
+}
+
+// Tout reconstruire depuis un pool (Rebuild everything from a pool)
+template <uint8_t N, typename P>
+inline void grille_construire(Grille<N>* g, const P* pool, uint8_t taille) {
+  grille_vider(g);
+  for (uint8_t i = 0; i < taille; i++) {
+    if (grille_actif(pool, i)) grille_placer(g, i, grille_posX(pool, i), grille_posY(pool, i));
+  }
+}
+
+// Le plus petit index dont le point est dans [x1, x2] x [y1, y2]
+// et à moins de "distance" de (x, y) si distance > 0
+// (Lowest index whose point is in the box and, if distance > 0,
+// closer than "distance" to (x, y))
+template <uint8_t N, typename P>
+inline int grille_chercher(const Grille<N>* g, const P* pool,
+                           int x1, int y1, int x2, int y2,
+                           int x, int y, int distance) {
+  int meilleur = -1;
+  uint8_t c1 = grille_colonne(x1), c2 = grille_colonne(x2);
+  uint8_t l2 = grille_ligne(y2);
+  for (uint8_t l = grille_ligne(y1); l <= l2; l++) {
+    for (uint8_t c = c1; c <= c2; c++) {
+      for (uint8_t i = g->tete[l * GRILLE_COLONNES + c]; i != GRILLE_VIDE; i = g->suivant[i]) {
+        if (meilleur >= 0 && i > meilleur) continue;
+        int px = grille_posX(pool, i);
+        int py = grille_posY(pool, i);
+        bool dedans = distance > 0 ? phys_touchePoint(px, py, x, y, distance)
+                                   : phys_pointDansBoite(px, py, x1, y1, x2 - x1, y2 - y1);
+        if (dedans) meilleur = i;
+      }
+    }
+  }
+  return meilleur;
+}
+
+// Comme obj_touchePoint (Like obj_touchePoint)
+template <uint8_t N, typename P>
+inline int grille_touchePoint(const Grille<N>* g, const P* pool, int x, int y, int distance) {
+  if (distance <= 0) return -1;
+  return grille_chercher(g, pool, x - distance + 1, y - distance + 1,
+                         x + distance - 1, y + distance - 1, x, y, distance);
+}
+
+// Un point d'objet dans la boîte? Comme phys_pointDansBoite
+// (An object point inside the box? Like phys_pointDansBoite)
+template <uint8_t N, typename P>
+inline int grille_toucheBoite(const Grille<N>* g, const P* pool, int x, int y, int largeur, int hauteur) {
+  return grille_chercher(g, pool, x, y, x + largeur, y + hauteur, 0, 0, 0);
+}
+
+// Comme obj_touchePool: "pool1" est parcouru, "pool2" est dans
+// la grille (Like obj_touchePool: pool1 is walked, pool2 is in
+// the grid)
+template <uint8_t N, typename P1, typename P2>
+inline int grille_touchePool(const Grille<N>* g2, const P2* pool2,
+                             const P1* pool1, uint8_t taille1,
+                             int distance, int* indexPool2) {
+  for (uint8_t i = 0; i < taille1; i++) {
+    if (!grille_actif(pool1, i)) continue;
+    int j = grille_touchePoint(g2, pool2, grille_posX(pool1, i), grille_posY(pool1, i), distance);
+    if (j >= 0) {
+      *indexPool2 = j;
+      return i;
+    }
+  }
+  return -1;
+}
+
 // ==========================================================
 // FONCTIONS POUR PLATEFORMES (Platform functions)
 // ==========================================================
@@ -289,20 +583,24 @@ inline int objm_touchePoint(ObjetMobile* pool, int taille,
 // (For platform games like Aventurier)
 
 // Charger plateformes depuis PROGMEM vers pool ObjetSimple
-// Source: tableau PROGMEM [n][3] = {x, y, largeur}
-// (Load platforms from PROGMEM to ObjetSimple pool)
-inline void obj_chargerPlateformes(const uint8_t* source, 
-                                    ObjetSimple* pool, int taille) {
-  for (int i = 0; i < taille; i++) {
-    int base = i * 3;
-    pool[i].x = pgm_read_byte(&source[base]);
-    pool[i].y = pgm_read_byte(&source[base + 1]);
-    pool[i].largeur = pgm_read_byte(&source[base + 2]);
+// Source: PLATEFORMES_PROGMEM (Load platforms from PROGMEM to pool)
+inline void obj_chargerPlateformes(PmArray<PmPlateforme> source, ObjetSimple* pool) {
+  for (uint16_t i = 0; i < source.taille; i++) {
+    PmStruct<PmPlateforme> p = source.ligne(i);
+    pool[i].x = p.lire(&PmPlateforme::x);
+    pool[i].y = p.lire(&PmPlateforme::y);
+    pool[i].largeur = p.lire(&PmPlateforme::largeur);
     pool[i].type = 1;  // Type plateforme
     pool[i].actif = true;
   }
 }
 
+// Source: tableau PROGMEM [n][3] = {x, y, largeur} (NIVEAU_PROGMEM)
+inline void obj_chargerPlateformes(const uint8_t* source, 
+                                    ObjetSimple* pool, int taille) {
+  obj_chargerPlateformes(pm_tableau((const PmPlateforme*)source, taille), pool);
+}
+
 // Vérifier collision rectangle avec un pool de plateformes
 // Parfait pour: atterrissage joueur sur plateforme
 // (Check rectangle collision with platform pool)
@@ -321,28 +619,397 @@ inline int obj_touchePlateforme(ObjetSimple* pool, int taille,
   return -1;
 }
 
+// Le pied (x, piedY) est-il posé sur la plateforme px, py, pl?
+// (Is the foot standing on platform px, py, pl?)
+inline bool obj_piedSurPlateforme(int px, int py, int pl,
+                                  int x, int piedY, int vitesseY) {
+  return x >= px - 3 && x <= px + pl + 3 &&
+         piedY >= py - 2 && piedY <= py + 5 &&
+         vitesseY >= 0;
+}
+
 // Vérifier si un point est au-dessus d'une plateforme
 // (Check if a point is above a platform - for landing)
 inline int obj_surPlateforme(ObjetSimple* pool, int taille,
                               int x, int piedY, int vitesseY) {
   for (int i = 0; i < taille; i++) {
-    if (pool[i].actif) {
-      int px = pool[i].x;
-      int py = pool[i].y;
-      int pl = pool[i].largeur;
-      
-      if (x >= px - 3 && x <= px + pl + 3) {
-        if (piedY >= py - 2 && piedY <= py + 5) {
-          if (vitesseY >= 0) {
-            return i;  // Sur cette plateforme!
-          }
-        }
-      }
+    if (pool[i].actif &&
+        obj_piedSurPlateforme(pool[i].x, pool[i].y, pool[i].largeur, x, piedY, vitesseY)) {
+      return i;  // Sur cette plateforme!
+    }
+  }
+  return -1;
+}
+
+// ----------------------------------------------------------
+// Plateformes lues en Flash (Platforms read from Flash)
+// ----------------------------------------------------------
+// Mêmes tests, mais directement sur un tableau
+// PLATEFORMES_PROGMEM: rien n'est copié en RAM. Un niveau fixe
+// peut donc avoir autant de plateformes que la Flash le permet;
+// seuls les objets qui bougent ou disparaissent ont un pool.
+// (Same tests, but straight on a PLATEFORMES_PROGMEM table:
+// nothing is copied to RAM. A fixed level can have as many
+// platforms as Flash allows; only objects that move or vanish
+// need a pool.)
+
+// Retourne l'index de la plateforme touchée, ou -1
+// (Returns the index of the platform hit, or -1)
+inline int obj_touchePlateformeFlash(PmArray<PmPlateforme> plat,
+                                     int x, int y, int largeurObjet, int hauteurObjet) {
+  for (uint16_t i = 0; i < plat.taille; i++) {
+    PmStruct<PmPlateforme> p = plat.ligne(i);
+    if (phys_toucheBoite(x, y, largeurObjet, hauteurObjet,
+                         p.lire(&PmPlateforme::x), p.lire(&PmPlateforme::y),
+                         p.lire(&PmPlateforme::largeur), 4)) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+inline int obj_surPlateformeFlash(PmArray<PmPlateforme> plat,
+                                  int x, int piedY, int vitesseY) {
+  if (vitesseY < 0) return -1;  // En montée: rien (Going up: nothing)
+  for (uint16_t i = 0; i < plat.taille; i++) {
+    PmStruct<PmPlateforme> p = plat.ligne(i);
+    if (obj_piedSurPlateforme(p.lire(&PmPlateforme::x), p.lire(&PmPlateforme::y),
+                              p.lire(&PmPlateforme::largeur), x, piedY, vitesseY)) {
+      return i;
     }
   }
   return -1;
 }
 
+// ==========================================================
+// CARTE DE COLLISION (Static collision map)
+// ==========================================================
+// Le décor qui ne bouge pas (plateformes, murs, obstacles)
+// rangé en BITS: l'écran coupé en 32 x 16 cases de 4 x 4
+// pixels, 1 bit par case = 64 octets. Construite une fois au
+// chargement du niveau, elle répond "y a-t-il du décor ici?"
+// en lisant un bit, sans parcourir les plateformes.
+// (Static scenery - platforms, walls, obstacles - stored as
+// BITS: the screen cut into 32 x 16 cells of 4 x 4 pixels,
+// 1 bit per cell = 64 bytes. Built once when the level loads,
+// it answers "is there scenery here?" by reading one bit,
+// without walking the platforms.)
+//
+// La carte est PRUDENTE: une case est pleine dès qu'un pixel
+// du décor y tombe. "Vide" est donc sûr, "plein" veut dire
+// "peut-être": on confirme avec le test exact (obj_...).
+// (The map is CONSERVATIVE: a cell is full as soon as one
+// scenery pixel falls in it. "Empty" is certain, "full" means
+// "maybe": confirm with the exact obj_... test.)
+//
+// x tourne tous les 128 pixels: un monde qui défile peut y
+// ranger ce qui est autour de la caméra. Deux morceaux à 128
+// pixels d'écart partagent des cases - encore un "peut-être".
+// y hors de 0-63: toujours vide.
+// (x wraps every 128 pixels, so a scrolling world can store
+// what is around the camera. Two chunks 128 pixels apart share
+// cells - just another "maybe". y outside 0-63: always empty.)
+
+#define CARTE_COLONNES 32
+#define CARTE_LIGNES 16
+#define CARTE_DECALAGE 2   // x >> 2 = colonne (4 pixels par case)
+
+struct CarteCollision {
+  uint8_t bits[CARTE_LIGNES * CARTE_COLONNES / 8];  // 4 octets par ligne
+};
+
+// Tout effacer (Clear everything)
+inline void carte_vider(CarteCollision* carte) {
+  memset(carte->bits, 0, sizeof(carte->bits));
+}
+
+// Octet et bit d'une case, colonne déjà repliée (Byte and bit of a cell)
+inline uint8_t* carte_octet(CarteCollision* carte, uint8_t colonne, uint8_t ligne) {
+  return &carte->bits[(ligne << 2) + (colonne >> 3)];
+}
+
+inline bool carte_case(const CarteCollision* carte, uint8_t colonne, uint8_t ligne) {
+  return (carte->bits[(ligne << 2) + (colonne >> 3)] >> (colonne & 7)) & 1;
+}
+
+// Une sonde = un bit (One probe = one bit)
+inline bool carte_occupe(const CarteCollision* carte, int x, int y) {
+  if (y < 0 || y >= CARTE_LIGNES << CARTE_DECALAGE) return false;
+  return carte_case(carte, (x >> CARTE_DECALAGE) & (CARTE_COLONNES - 1), y >> CARTE_DECALAGE);
+}
+
+// Lignes de cases touchées par y..y+hauteur, coupées à l'écran
+// Retourne false si rien n'est dans l'écran
+// (Cell rows touched by y..y+hauteur, clipped to the screen.
+// Returns false if nothing is on screen)
+inline bool carte_lignes(int y, int hauteur, uint8_t* l1, uint8_t* l2) {
+  int haut = y >> CARTE_DECALAGE;
+  int bas = (y + hauteur) >> CARTE_DECALAGE;
+  if (haut < 0) haut = 0;
+  if (bas >= CARTE_LIGNES) bas = CARTE_LIGNES - 1;
+  *l1 = haut;
+  *l2 = bas;
+  return haut <= bas;
+}
+
+// Nombre de colonnes touchées par x..x+largeur, 32 au plus
+// (Number of columns touched by x..x+largeur, 32 at most)
+inline uint8_t carte_nbColonnes(int x, int largeur) {
+  int n = ((x + largeur) >> CARTE_DECALAGE) - (x >> CARTE_DECALAGE) + 1;
+  return n > CARTE_COLONNES ? CARTE_COLONNES : n;
+}
+
+// Marquer une boîte, bords compris comme phys_toucheBoite
+// (Mark a box, edges included like phys_toucheBoite)
+inline void carte_remplirBoite(CarteCollision* carte, int x, int y, int largeur, int hauteur) {
+  uint8_t l1, l2;
+  if (!carte_lignes(y, hauteur, &l1, &l2)) return;
+  uint8_t n = carte_nbColonnes(x, largeur);
+  for (uint8_t l = l1; l <= l2; l++) {
+    uint8_t colonne = x >> CARTE_DECALAGE;
+    for (uint8_t i = 0; i < n; i++, colonne++) {
+      colonne &= CARTE_COLONNES - 1;
+      *carte_octet(carte, colonne, l) |= (uint8_t)(1 << (colonne & 7));
+    }
+  }
+}
+
+// Une case pleine sous la boîte? Même contrat que
+// phys_toucheBoite, mais "true" veut dire "peut-être"
+// (Any full cell under the box? Same contract as
+// phys_toucheBoite, but "true" means "maybe")
+inline bool carte_toucheBoite(const CarteCollision* carte, int x, int y, int largeur, int hauteur) {
+  uint8_t l1, l2;
+  if (!carte_lignes(y, hauteur, &l1, &l2)) return false;
+  uint8_t n = carte_nbColonnes(x, largeur);
+  uint8_t premiere = (x >> CARTE_DECALAGE) & (CARTE_COLONNES - 1);
+  for (uint8_t l = l1; l <= l2; l++) {
+    const uint8_t* ligne = &carte->bits[l << 2];
+    uint8_t colonne = premiere;
+    for (uint8_t i = 0; i < n; i++) {
+      if ((ligne[colonne >> 3] >> (colonne & 7)) & 1) return true;
+      colonne = (colonne + 1) & (CARTE_COLONNES - 1);
+    }
+  }
+  return false;
+}
+
+// Une plateforme a 4 pixels de haut, comme obj_touchePlateforme
+// (A platform is 4 pixels tall, like obj_touchePlateforme)
+inline void carte_ajouterPlateforme(CarteCollision* carte, int x, int y, int largeur) {
+  carte_remplirBoite(carte, x, y, largeur, 4);
+}
+
+// Toutes les plateformes d'un tableau en Flash (All platforms of a Flash table)
+inline void carte_ajouterPlateformes(CarteCollision* carte, PmArray<PmPlateforme> plat) {
+  for (uint16_t i = 0; i < plat.taille; i++) {
+    PmStruct<PmPlateforme> p = plat.ligne(i);
+    carte_ajouterPlateforme(carte, p.lire(&PmPlateforme::x), p.lire(&PmPlateforme::y),
+                            p.lire(&PmPlateforme::largeur));
+  }
+}
+
+// Les plateformes actives d'un pool (The active platforms of a pool)
+inline void carte_ajouterPlateformes(CarteCollision* carte, ObjetSimple* pool, int taille) {
+  for (int i = 0; i < taille; i++) {
+    if (pool[i].actif) carte_ajouterPlateforme(carte, pool[i].x, pool[i].y, pool[i].largeur);
+  }
+}
+
+// obj_piedSurPlateforme peut-il répondre oui? Sa tolérance
+// (x à 3 pixels du bord, pied de 2 au-dessus à 5 dedans)
+// devient une boîte de 7 x 8 pixels autour du pied: au plus
+// 3 x 3 cases. Faux = aucune plateforme, inutile de chercher.
+// (Can obj_piedSurPlateforme say yes? Its tolerance - x within
+// 3 pixels of the edge, foot from 2 above to 5 inside - becomes
+// a 7 x 8 pixel box around the foot: 3 x 3 cells at most.
+// False = no platform, no need to search.)
+inline bool carte_solPossible(const CarteCollision* carte, int x, int piedY) {
+  return carte_toucheBoite(carte, x - 3, piedY - 5, 6, 7);
+}
+
+// ==========================================================
+// POOL À BITS (Bitmask pool)
+// ==========================================================
+// Pool<T, N>: N cases de T, et "qui est vivant" rangé en BITS
+// (1 octet pour 8 cases) au lieu d'un bool par objet.
+// - creer(): O(1) jusqu'à 64 cases - un octet "pleins" dit
+//   quel octet de bits a une case libre, une table de 16
+//   octets en Flash donne le premier bit.
+// - suivant(): saute 8 cases mortes d'un coup.
+// - nombre: tenu à jour, pas besoin de compter.
+// (Pool<T, N>: N slots of T, with "who is alive" stored as BITS
+// - 1 byte per 8 slots - instead of one bool per object.
+// creer() is O(1) up to 64 slots: a "full" byte tells which
+// bit byte has a free slot, a 16-byte Flash table gives the
+// first bit. suivant() skips 8 dead slots at once. nombre is
+// kept up to date, no counting needed.)
+//
+// Avec un Pool, T n'a pas besoin de "actif": ObjetLeger et
+// MobileLeger sont ObjetSimple et ObjetMobile sans lui.
+// (With a Pool, T needs no "actif" field.)
+//
+//   Pool<MobileLeger, 6> balles;    // 42 + 3 octets (48 avant)
+//   int i = balles.creer();
+//   if (i >= 0) { balles[i].x = 10; ... }
+//   POUR_CHAQUE_VIVANT(balles, b) { dessinerPixel(b.x, b.y); }
+//   balles.liberer(i);
+
+struct ObjetLeger {
+  int8_t x;
+  int8_t y;
+  int8_t largeur;
+  int8_t type;
+};
+
+struct MobileLeger {
+  int8_t x;
+  int8_t y;
+  int8_t vx;
+  int8_t vy;
+  int8_t largeur;
+  int8_t param;
+  int8_t type;
+};
+
+// Premier bit à 1 d'un demi-octet, 4 si aucun
+// (Lowest set bit of a nibble, 4 if none)
+const uint8_t pool_premierBitTable[16] PROGMEM = {
+  4, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0
+};
+
+// Premier bit à 1 d'un octet non nul (Lowest set bit of a non-zero byte)
+inline uint8_t pool_premierBit(uint8_t octet) {
+  if (octet & 0x0F) return pgm_read_byte(&pool_premierBitTable[octet & 0x0F]);
+  return 4 + pgm_read_byte(&pool_premierBitTable[octet >> 4]);
+}
+
+template <typename T, uint8_t N>
+struct Pool {
+  static const uint8_t OCTETS = (N + 7) / 8;
+  static const uint8_t RESUMES = (OCTETS + 7) / 8;
+
+  T objets[N];
+  uint8_t vivants[OCTETS];  // Bit i = case i utilisée (Bit i = slot i in use)
+  uint8_t pleins[RESUMES];  // Bit k = octet k plein (Bit k = byte k full)
+  uint8_t nombre;
+
+  Pool() { vider(); }
+
+  void vider() {
+    for (uint8_t k = 0; k < OCTETS; k++) vivants[k] = 0;
+    for (uint8_t k = 0; k < RESUMES; k++) pleins[k] = 0;
+    // Bits après N: toujours "pris" (Bits past N: always "taken")
+    if (N & 7) vivants[OCTETS - 1] = (uint8_t)(0xFF << (N & 7));
+    if (OCTETS & 7) pleins[RESUMES - 1] = (uint8_t)(0xFF << (OCTETS & 7));
+    nombre = 0;
+  }
+
+  // Prend une case libre, -1 si plein (Takes a free slot, -1 if full)
+  int creer() {
+    for (uint8_t r = 0; r < RESUMES; r++) {
+      uint8_t libres = ~pleins[r];
+      if (!libres) continue;
+      uint8_t k = r * 8 + pool_premierBit(libres);
+      uint8_t bit = pool_premierBit(~vivants[k]);
+      vivants[k] |= 1 << bit;
+      if (vivants[k] == 0xFF) pleins[r] |= 1 << (k & 7);
+      nombre++;
+      return k * 8 + bit;
+    }
+    return -1;
+  }
+
+  void liberer(uint8_t i) {
+    uint8_t k = i >> 3;
+    if (!(vivants[k] & (1 << (i & 7)))) return;
+    vivants[k] &= ~(1 << (i & 7));
+    pleins[k >> 3] &= ~(1 << (k & 7));
+    nombre--;
+  }
+
+  bool vivant(uint8_t i) const {
+    return vivants[i >> 3] & (1 << (i & 7));
+  }
+
+  // Prochaine case vivante à partir de i, -1 si aucune
+  // (Next live slot from i, -1 if none)
+  int suivant(int i) const {
+    if (i >= N) return -1;
+    uint8_t k = i >> 3;
+    uint8_t octet = vivants[k] & (0xFF << (i & 7));
+    if (k == OCTETS - 1 && (N & 7)) octet &= 0xFF >> (8 - (N & 7));
+    while (!octet) {
+      if (++k >= OCTETS) return -1;
+      octet = vivants[k];
+      if (k == OCTETS - 1 && (N & 7)) octet &= 0xFF >> (8 - (N & 7));
+    }
+    return k * 8 + pool_premierBit(octet);
+  }
+
+  T& operator[](uint8_t i) { return objets[i]; }
+  const T& operator[](uint8_t i) const { return objets[i]; }
+};
+
+// Boucle sur les cases vivantes seulement. "break" passe à la
+// suivante, comme "continue". (Loop over live slots only.
+// "break" moves to the next one, like "continue".)
+#define POUR_CHAQUE_VIVANT(pool, var) \
+  for (int _i = (pool).suivant(0); _i >= 0; _i = (pool).suivant(_i + 1)) \
+    for (bool _une = true; _une; _une = false) \
+      for (auto& var = (pool)[_i]; _une; _une = false)
+
+// Mêmes services que obj_ / objm_ (Same services as obj_ / objm_)
+template <uint8_t N>
+inline int obj_creer(Pool<ObjetLeger, N>* pool, int x, int y, int largeur, int type) {
+  int i = pool->creer();
+  if (i >= 0) {
+    ObjetLeger& o = (*pool)[i];
+    o.x = x;
+    o.y = y;
+    o.largeur = largeur;
+    o.type = type;
+  }
+  return i;
+}
+
+template <typename T, uint8_t N>
+inline int obj_touchePoint(const Pool<T, N>* pool, int x, int y, int distance) {
+  for (int i = pool->suivant(0); i >= 0; i = pool->suivant(i + 1)) {
+    if (phys_touchePoint((*pool)[i].x, (*pool)[i].y, x, y, distance)) return i;
+  }
+  return -1;
+}
+
+template <uint8_t N>
+inline int objm_creer(Pool<MobileLeger, N>* pool, int x, int y, int vx, int vy,
+                      int largeur, int param, int type) {
+  int i = pool->creer();
+  if (i >= 0) {
+    MobileLeger& o = (*pool)[i];
+    o.x = x;
+    o.y = y;
+    o.vx = vx;
+    o.vy = vy;
+    o.largeur = largeur;
+    o.param = param;
+    o.type = type;
+  }
+  return i;
+}
+
+template <uint8_t N>
+inline void objm_bougerTous(Pool<MobileLeger, N>* pool, int marge) {
+  for (int i = pool->suivant(0); i >= 0; i = pool->suivant(i + 1)) {
+    MobileLeger& o = (*pool)[i];
+    o.x = o.x + o.vx;
+    o.y = o.y + o.vy;
+    if (o.x < -marge || o.x > 128 + marge || o.y < -marge || o.y > 64 + marge) {
+      pool->liberer(i);
+    }
+  }
+}
+
 // ==========================================================
 // MACROS PRATIQUES (Convenience macros)
 // ==========================================================
@@ -194,9 +194,9 @@ void dessinerChampionPlateforme(int x, int y, int direction, int frame) {
   }
 }
 
-// Dessiner personnage vue plateforme (Platform view character)
-// API unifiée pour tous les jeux de plateforme
-void pers_dessinerPlateforme(int x, int y, int numero, int direction, int frame) {
+// Dessiner personnage vue plateforme avec les formes
+// (Platform view character drawn with shapes)
+void pers_dessinerPlateformeFormes(int x, int y, int numero, int direction, int frame) {
   if (numero == PERSO_BLOB) {
     dessinerBlobPlateforme(x, y);
   } else if (numero == PERSO_BONHOMME) {
@@ -263,8 +263,8 @@ void dessinerChampionVueHaut(int x, int y, int taille, int direction) {
   }
 }
 
-// API unifiée vue de dessus (Unified top-view API)
-void pers_dessinerVueHaut(int x, int y, int taille, int numero, int direction) {
+// Vue de dessus avec les formes (Top view drawn with shapes)
+void pers_dessinerVueHautFormes(int x, int y, int taille, int numero, int direction) {
   if (numero == PERSO_BLOB) {
     dessinerBlobVueHaut(x, y, taille);
   } else if (numero == PERSO_CHAMPION) {
@@ -275,6 +275,101 @@ void pers_dessinerVueHaut(int x, int y, int taille, int numero, int direction) {
   }
 }
 
+// ==========================================================
+// IMAGES PRÉ-DESSINÉES (Pre-drawn pictures)
+// ==========================================================
+// Les formes ci-dessus coûtent 5 à 10 appels par page, donc
+// jusqu'à 80 par image. "make assets" les dessine UNE fois
+// sur l'ordinateur (tools/personnages) et range le résultat
+// en Flash dans PersonnagesImages.h: le jeu n'a plus qu'un
+// dessinerSprite() à faire.
+// (The shapes above cost 5 to 10 calls per page, so up to 80
+// per frame. "make assets" draws them ONCE on the computer and
+// stores the result in Flash: the game does one dessinerSprite.)
+//
+// Images vue plateforme: droite 0-1, gauche 2-3 (marche 0/1)
+// Images vue de dessus: une par direction, DIR_HAUT à DIR_GAUCHE
+// (Platform frames: right 0-1, left 2-3. Top-view frames: one
+// per direction.)
+
+// Taille pré-dessinée en vue de dessus (Pre-drawn top-view size)
+#define PERS_TAILLE_VUE_HAUT 6
+
+// Un sprite + où le poser par rapport au point (x, y) du dessin
+// (A sprite + where to put it relative to the drawing's point)
+struct PersImage {
+  const Sprite* sprite;
+  int8_t decalX;
+  int8_t decalY;
+};
+
+// Sans images: l'outil qui les fabrique (Without pictures: the tool that makes them)
+#ifndef PERS_SANS_IMAGES
+#include "PersonnagesImages.h"
+
+void pers_dessinerImage(const PersImage* table, int x, int y, uint8_t image) {
+  PmStruct<PersImage> p = { table };
+  const Sprite* sprite = p.lire(&PersImage::sprite);
+  PmStruct<Sprite> s = { sprite };
+  if (image >= s.lire(&Sprite::images)) image = 0;  // Blob: une seule image
+  dessinerSprite(x + p.lire(&PersImage::decalX), y + p.lire(&PersImage::decalY), sprite, image);
+}
+#endif
+
+// Dessiner personnage vue plateforme (Platform view character)
+// API unifiée pour tous les jeux de plateforme
+void pers_dessinerPlateforme(int x, int y, int numero, int direction, int frame) {
+#ifdef PERS_SANS_IMAGES
+  pers_dessinerPlateformeFormes(x, y, numero, direction, frame);
+#else
+  if (numero < 0 || numero >= NOMBRE_PERSONNAGES) return;
+  uint8_t image = (direction == DIR_DROITE ? 0 : 2) + (frame != 0 ? 1 : 0);
+  pers_dessinerImage(&pers_imagesPlateforme[numero], x, y, image);
+#endif
+}
+
+// API unifiée vue de dessus (Unified top-view API)
+// Autre taille: retour aux formes (Other size: back to shapes)
+void pers_dessinerVueHaut(int x, int y, int taille, int numero, int direction) {
+#ifndef PERS_SANS_IMAGES
+  if (taille == PERS_TAILLE_VUE_HAUT && numero >= 0 && numero < NOMBRE_PERSONNAGES &&
+      direction >= DIR_HAUT && direction <= DIR_GAUCHE) {
+    pers_dessinerImage(&pers_imagesVueHaut[numero], x, y, direction);
+    return;
+  }
+#endif
+  pers_dessinerVueHautFormes(x, y, taille, numero, direction);
+}
+
+// Le personnage vue de dessus touche un sprite? numero et
+// direction choisissent l'image pré-dessinée, testée au pixel
+// près contre l'image "image" de l'autre. Pour une autre taille
+// (ou sans images), le personnage est une boîte taille x taille,
+// testée contre les pixels de l'autre.
+// (Does the top-view character touch a sprite? numero and
+// direction pick the pre-drawn picture, tested pixel-perfect
+// against the other's frame "image". For another size - or
+// without pictures - the character is a taille x taille box,
+// tested against the other's pixels.)
+bool pers_toucheVueHaut(int x, int y, int taille, int numero, int direction,
+                        int autreX, int autreY, const Sprite* autre, uint8_t image) {
+#ifndef PERS_SANS_IMAGES
+  if (taille == PERS_TAILLE_VUE_HAUT && numero >= 0 && numero < NOMBRE_PERSONNAGES &&
+      direction >= DIR_HAUT && direction <= DIR_GAUCHE) {
+    PmStruct<PersImage> p = { &pers_imagesVueHaut[numero] };
+    const Sprite* sprite = p.lire(&PersImage::sprite);
+    uint8_t imagePerso = direction;
+    if (imagePerso >= PmStruct<Sprite>{ sprite }.lire(&Sprite::images)) imagePerso = 0;
+    return toucheSprites(x + p.lire(&PersImage::decalX), y + p.lire(&PersImage::decalY),
+                         sprite, imagePerso, autreX, autreY, autre, image);
+  }
+#else
+  (void)numero;     // Sans images: la boîte seule (No pictures: the box only)
+  (void)direction;
+#endif
+  return toucheBoiteSprite(x, y, taille + 1, taille + 1, autreX, autreY, autre, image);
+}
+
 // ==========================================================
 // COMPATIBILITÉ (Backward compatibility)
 // ==========================================================
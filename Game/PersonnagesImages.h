@@ -0,0 +1,133 @@
+// ==========================================================
+// PERSONNAGESIMAGES.H - Personnages pré-dessinés
+// (Pre-drawn characters)
+// ==========================================================
+// Généré par tools/personnages/personnages.cpp depuis les
+// formes de Personnages.h (make assets) - ne pas modifier!
+// (Generated from the shapes in Personnages.h - do not edit!)
+// ==========================================================
+
+#ifndef PERSONNAGESIMAGES_H
+#define PERSONNAGESIMAGES_H
+
+// Inclus par Personnages.h (Included by Personnages.h)
+
+// ----------------------------------------------------------
+// Vue plateforme (Platform view)
+// ----------------------------------------------------------
+
+// blob: 9x9, 1 image(s)
+const uint8_t pers_plateforme_blob_dessin[] PROGMEM = {
+  0x38, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0x38,
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+};
+const Sprite pers_plateforme_blob PROGMEM = { pers_plateforme_blob_dessin, nullptr, 9, 9, 2, 1 };
+
+// bonhomme: 11x17, 4 image(s)
+const uint8_t pers_plateforme_bonhomme_dessin[] PROGMEM = {
+  0x00, 0x00, 0x1C, 0xBE, 0xFF, 0xFF, 0xFF, 0x3E, 0x1C, 0x00, 0x00,
+  0x00, 0x08, 0x06, 0xCF, 0x3F, 0x0F, 0x3F, 0xC1, 0x02, 0x02, 0x04,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x1C, 0xBE, 0xFF, 0xFF, 0xFF, 0x3E, 0x1C, 0x00, 0x00,
+  0x00, 0x08, 0x06, 0x8F, 0x7F, 0x0F, 0x7F, 0x81, 0x02, 0x02, 0x04,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1C, 0xBE, 0xFF, 0xFF, 0xFF, 0x3E, 0x1C, 0x00, 0x00,
+  0x04, 0x02, 0x02, 0xCF, 0x3F, 0x0F, 0x3F, 0xC1, 0x06, 0x08, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x1C, 0xBE, 0xFF, 0xFF, 0xFF, 0x3E, 0x1C, 0x00, 0x00,
+  0x04, 0x02, 0x02, 0x8F, 0x7F, 0x0F, 0x7F, 0x81, 0x06, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+};
+const Sprite pers_plateforme_bonhomme PROGMEM = { pers_plateforme_bonhomme_dessin, nullptr, 11, 17, 3, 4 };
+
+// heros: 11x17, 4 image(s)
+const uint8_t pers_plateforme_heros_dessin[] PROGMEM = {
+  0x00, 0x00, 0x1C, 0xBE, 0xFF, 0xFF, 0xFF, 0x3E, 0x1C, 0x00, 0x00,
+  0x08, 0x04, 0x02, 0x0F, 0xFF, 0x0F, 0xFF, 0x01, 0x02, 0x04, 0x08,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1C, 0xBE, 0xFF, 0xFF, 0xFF, 0x3E, 0x1C, 0x00, 0x00,
+  0x08, 0x04, 0x02, 0xCF, 0x3F, 0x0F, 0x3F, 0xC1, 0x02, 0x04, 0x08,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x1C, 0xBE, 0xFF, 0xFF, 0xFF, 0x3E, 0x1C, 0x00, 0x00,
+  0x08, 0x04, 0x02, 0x0F, 0xFF, 0x0F, 0xFF, 0x01, 0x02, 0x04, 0x08,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1C, 0xBE, 0xFF, 0xFF, 0xFF, 0x3E, 0x1C, 0x00, 0x00,
+  0x08, 0x04, 0x02, 0xCF, 0x3F, 0x0F, 0x3F, 0xC1, 0x02, 0x04, 0x08,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+};
+const Sprite pers_plateforme_heros PROGMEM = { pers_plateforme_heros_dessin, nullptr, 11, 17, 3, 4 };
+
+// champion: 16x17, 4 image(s)
+const uint8_t pers_plateforme_champion_dessin[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xBE, 0xFF, 0xFF, 0xFF, 0x3E, 0x1C, 0x80, 0x80, 0xFC, 0xFC,
+  0x00, 0x00, 0x00, 0x08, 0x04, 0x02, 0x0F, 0xFF, 0x0F, 0xFF, 0x01, 0x01, 0x00, 0x00, 0x03, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xBE, 0xFF, 0xFF, 0xFF, 0x3E, 0x1C, 0x80, 0x80, 0xFC, 0xFC,
+  0x00, 0x00, 0x00, 0x08, 0x04, 0x02, 0xCF, 0x3F, 0x0F, 0x3F, 0xC1, 0x01, 0x00, 0x00, 0x03, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0xFC, 0xFC, 0x40, 0x40, 0x80, 0x9C, 0xBE, 0xFF, 0xFF, 0xFF, 0x3E, 0x1C, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x0F, 0xFF, 0x01, 0x02, 0x04, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFC, 0xFC, 0x40, 0x40, 0x80, 0x9C, 0xBE, 0xFF, 0xFF, 0xFF, 0x3E, 0x1C, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x3F, 0x0F, 0x3F, 0xC1, 0x02, 0x04, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+};
+const Sprite pers_plateforme_champion PROGMEM = { pers_plateforme_champion_dessin, nullptr, 16, 17, 3, 4 };
+
+const PersImage pers_imagesPlateforme[NOMBRE_PERSONNAGES] PROGMEM = {
+  { &pers_plateforme_blob, -4, -4 },
+  { &pers_plateforme_bonhomme, -5, -9 },
+  { &pers_plateforme_heros, -5, -8 },
+  { &pers_plateforme_champion, -8, -8 },
+};
+
+// ----------------------------------------------------------
+// Vue de dessus, taille 6 (Top view, size 6)
+// ----------------------------------------------------------
+
+// blob: 7x7, 1 image(s)
+const uint8_t pers_vueHaut_blob_dessin[] PROGMEM = {
+  0x1C, 0x3E, 0x7F, 0x7F, 0x7F, 0x3E, 0x1C,
+};
+const Sprite pers_vueHaut_blob PROGMEM = { pers_vueHaut_blob_dessin, nullptr, 7, 7, 1, 1 };
+
+// bonhomme: 12x11, 4 image(s)
+const uint8_t pers_vueHaut_bonhomme_dessin[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x74, 0xFE, 0xFF, 0xFE, 0x74, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x70, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x70, 0x20,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x80, 0xF0, 0xF8, 0xF8, 0xF8, 0xF0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00,
+  0x20, 0x20, 0x70, 0xF8, 0x70, 0xF8, 0xF8, 0xF8, 0x70, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+const Sprite pers_vueHaut_bonhomme PROGMEM = { pers_vueHaut_bonhomme_dessin, nullptr, 12, 11, 2, 4 };
+
+// heros: comme bonhomme (same as bonhomme)
+
+// champion: 22x22, 4 image(s)
+const uint8_t pers_vueHaut_champion_dessin[] PROGMEM = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x3F, 0x3F, 0x3F, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x1C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x7C, 0xFE, 0xFE, 0xFE, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x08, 0x1C, 0x3E, 0x1C, 0x3E, 0x3E, 0x3E, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+const Sprite pers_vueHaut_champion PROGMEM = { pers_vueHaut_champion_dessin, nullptr, 22, 22, 3, 4 };
+
+const PersImage pers_imagesVueHaut[NOMBRE_PERSONNAGES] PROGMEM = {
+  { &pers_vueHaut_blob, 0, 0 },
+  { &pers_vueHaut_bonhomme, -3, -2 },
+  { &pers_vueHaut_bonhomme, -3, -2 },
+  { &pers_vueHaut_champion, -8, -8 },
+};
+
+#endif
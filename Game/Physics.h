@@ -10,6 +10,8 @@
 #ifndef PHYSICS_H
 #define PHYSICS_H
 
+#include <avr/pgmspace.h>
+
 // ==========================================================
 // FONCTIONS DE DISTANCE (Distance functions)
 // ==========================================================
@@ -80,6 +82,187 @@ inline bool phys_toucheCercle(int x1, int y1, int r1,
   return (dist < r1 + r2);
 }
 
+// ==========================================================
+// COLLISION AU PIXEL PRÈS (Pixel-perfect collision)
+// ==========================================================
+// Deux masques 1 bit en PROGMEM, au format de l'écran (comme
+// Sprites.h): 1 octet = une colonne de 8 pixels, rangés
+// [page][colonne], bit 0 = pixel du haut.
+// 1. Les boîtes ne se touchent pas? Fini - même prix que
+//    phys_toucheBoite.
+// 2. Sinon, pour chaque colonne commune, l'octet du masque 1
+//    est comparé (AND) aux pixels du masque 2 à la même
+//    hauteur: deux octets décalés et réunis.
+// (Two 1-bit PROGMEM masks in screen format, like Sprites.h.
+// 1. Boxes apart? Done - same price as phys_toucheBoite.
+// 2. Otherwise, for each shared column, the mask 1 byte is
+//    ANDed with the mask 2 pixels at the same height: two
+//    bytes shifted and joined.)
+//
+// x, y = coin haut-gauche (top-left corner)
+// masque = début de l'image (start of the frame)
+
+// Les 8 pixels d'une colonne du masque, à partir de la ligne
+// "ligne" (peut être négative ou dépasser: zéros)
+// (The 8 pixels of a mask column starting at row "ligne" -
+// may be negative or past the end: zeros)
+inline uint8_t phys_colonneMasque(const uint8_t* masque, uint8_t largeur, uint8_t pages,
+                                  uint8_t colonne, int ligne) {
+  int page = ligne >> 3;
+  uint8_t decalage = ligne & 7;
+  uint8_t octet = 0;
+  if (page >= 0 && page < pages) {
+    octet = pgm_read_byte(masque + page * largeur + colonne) >> decalage;
+  }
+  if (decalage != 0 && page + 1 >= 0 && page + 1 < pages) {
+    octet |= pgm_read_byte(masque + (page + 1) * largeur + colonne) << (8 - decalage);
+  }
+  return octet;
+}
+
+inline bool phys_toucheMasques(int x1, int y1, const uint8_t* masque1, uint8_t largeur1, uint8_t hauteur1,
+                               int x2, int y2, const uint8_t* masque2, uint8_t largeur2, uint8_t hauteur2) {
+  // 1. Boîtes (Boxes)
+  if (x1 >= x2 + largeur2 || x2 >= x1 + largeur1) return false;
+  if (y1 >= y2 + hauteur2 || y2 >= y1 + hauteur1) return false;
+  
+  // 2. Zone commune (Shared area)
+  int debut = x1 > x2 ? x1 : x2;
+  int fin = x1 + largeur1 < x2 + largeur2 ? x1 + largeur1 : x2 + largeur2;
+  int haut = y1 > y2 ? y1 : y2;
+  int bas = y1 + hauteur1 < y2 + hauteur2 ? y1 + hauteur1 : y2 + hauteur2;
+  uint8_t pages2 = (hauteur2 + 7) >> 3;
+  
+  // Pages du masque 1 dans la zone (Mask 1 pages inside the area)
+  for (int page = (haut - y1) >> 3; page <= (bas - 1 - y1) >> 3; page++) {
+    const uint8_t* colonnes1 = masque1 + page * largeur1 + (debut - x1);
+    int ligne2 = y1 + page * 8 - y2;
+    for (int x = debut; x < fin; x++) {
+      uint8_t octet = pgm_read_byte(colonnes1 + (x - debut));
+      if (octet && (octet & phys_colonneMasque(masque2, largeur2, pages2, x - x2, ligne2))) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+// ==========================================================
+// COLLISION EN MOUVEMENT (Swept collision)
+// ==========================================================
+// phys_toucheBoite regarde seulement OÙ la boîte arrive: une
+// balle qui avance de 6 pixels saute par-dessus une brique de
+// 5. phys_balayerBoite suit tout le TRAJET (dx, dy) et dit
+// QUAND la boîte touche l'autre (temps, de 0 à PHYS_TEMPS_UN)
+// et QUELLE face (la normale, -1 / 0 / 1 sur chaque axe).
+// (phys_toucheBoite only looks at WHERE the box ends up: a
+// ball moving 6 pixels jumps over a 5-pixel brick.
+// phys_balayerBoite follows the whole MOVE (dx, dy) and tells
+// WHEN the box touches the other one - time from 0 to
+// PHYS_TEMPS_UN - and WHICH face - the normal, -1 / 0 / 1 on
+// each axis.)
+//
+// Même contrat que phys_toucheBoite: bords compris, donc
+// "toucher" = être collé. Entiers seulement.
+// (Same contract as phys_toucheBoite: edges included, so
+// "touch" = side by side. Integers only.)
+
+#define PHYS_TEMPS_UN 256         // Le trajet entier (The whole move)
+#define PHYS_TEMPS_JAMAIS 0x7FFF  // Axe immobile (Axis not moving)
+
+struct Impact {
+  int temps;         // 0 = tout de suite, PHYS_TEMPS_UN = au bout (0 = now, PHYS_TEMPS_UN = at the end)
+  int8_t normaleX;   // Face touchée: -1 gauche, 1 droite (Face hit: -1 left, 1 right)
+  int8_t normaleY;   // -1 dessus, 1 dessous (-1 top, 1 bottom)
+};
+
+// distance / d en 1/256 du trajet, arrondi vers le bas
+// (distance / d in 1/256ths of the move, rounded down)
+inline int phys_tempsAxe(long distance, int d) {
+  long temps = distance * PHYS_TEMPS_UN;
+  temps = temps >= 0 ? temps / d : -((-temps + d - 1) / d);
+  if (temps > PHYS_TEMPS_JAMAIS) return PHYS_TEMPS_JAMAIS;
+  if (temps < -PHYS_TEMPS_JAMAIS) return -PHYS_TEMPS_JAMAIS;
+  return temps;
+}
+
+// Sur UN axe: quand les boîtes commencent et finissent de se
+// toucher. Retourne false si jamais.
+// (On ONE axis: when the boxes start and stop touching.
+// Returns false if never.)
+inline bool phys_balayerAxe(int a, int la, int d, int b, int lb, int* entree, int* sortie) {
+  if (d == 0) {
+    if (a + la < b || b + lb < a) return false;
+    *entree = -PHYS_TEMPS_JAMAIS;
+    *sortie = PHYS_TEMPS_JAMAIS;
+    return true;
+  }
+  if (d > 0) {
+    *entree = phys_tempsAxe((long)b - (a + la), d);
+    *sortie = phys_tempsAxe((long)b + lb - a, d);
+  } else {
+    *entree = phys_tempsAxe((long)a - (b + lb), -d);
+    *sortie = phys_tempsAxe((long)a + la - b, -d);
+  }
+  return true;
+}
+
+// La boîte 1 bouge de (dx, dy), la boîte 2 ne bouge pas.
+// Retourne true si elles se touchent pendant le trajet; déjà
+// collées et en train d'avancer l'une vers l'autre: temps 0.
+// Collées mais en train de s'éloigner, ou déjà l'une DANS
+// l'autre: false - ce n'est pas un choc, la boîte peut sortir.
+// (Box 1 moves by (dx, dy), box 2 stays still. Returns true if
+// they touch during the move; already touching and moving
+// closer: time 0. Touching but moving apart, or already one
+// INSIDE the other: false - not a hit, the box may get out.)
+inline bool phys_balayerBoite(int x1, int y1, int w1, int h1, int dx, int dy,
+                              int x2, int y2, int w2, int h2, Impact* impact) {
+  // 1. La boîte de tout le trajet ne touche pas? Fini, sans division
+  // (The whole-move box does not touch? Done, no division)
+  if (!phys_toucheBoite(dx < 0 ? x1 + dx : x1, dy < 0 ? y1 + dy : y1,
+                        w1 + (dx < 0 ? -dx : dx), h1 + (dy < 0 ? -dy : dy),
+                        x2, y2, w2, h2)) {
+    return false;
+  }
+
+  // 2. Entrée = la plus tardive des deux axes, sortie = la plus tôt
+  // (Entry = the later of both axes, exit = the earlier)
+  int entreeX, sortieX, entreeY, sortieY;
+  if (!phys_balayerAxe(x1, w1, dx, x2, w2, &entreeX, &sortieX)) return false;
+  if (!phys_balayerAxe(y1, h1, dy, y2, h2, &entreeY, &sortieY)) return false;
+  int entree = entreeX > entreeY ? entreeX : entreeY;
+  int sortie = sortieX < sortieY ? sortieX : sortieY;
+  if (entree < 0 || entree > sortie || sortie <= 0 || entree > PHYS_TEMPS_UN) return false;
+
+  // 3. La face: l'axe qui entre en dernier (les deux = un coin)
+  // (The face: the axis entering last - both = a corner)
+  impact->temps = entree;
+  impact->normaleX = (dx != 0 && entreeX == entree) ? (dx > 0 ? -1 : 1) : 0;
+  impact->normaleY = (dy != 0 && entreeY == entree) ? (dy > 0 ? -1 : 1) : 0;
+  return true;
+}
+
+// La part du trajet d faite au temps "temps", arrondie vers le
+// loin: sur l'axe du choc, la boîte arrive pile collée.
+// (The part of move d done at time "temps", rounded away from
+// zero: on the hit axis the box ends up exactly touching.)
+inline int phys_partieTrajet(int d, int temps) {
+  int n = ((long)(d < 0 ? -d : d) * temps + PHYS_TEMPS_UN - 1) / PHYS_TEMPS_UN;
+  return d < 0 ? -n : n;
+}
+
+// Avancer jusqu'au choc puis rebondir sur la face touchée.
+// Le reste du trajet est perdu (au plus un tic).
+// (Move up to the hit, then bounce off the face hit. The rest
+// of the move is dropped - one tick at most.)
+inline void phys_resoudreImpact(int* x, int* y, int* dx, int* dy, const Impact* impact) {
+  *x = *x + phys_partieTrajet(*dx, impact->temps);
+  *y = *y + phys_partieTrajet(*dy, impact->temps);
+  if (impact->normaleX != 0) *dx = -*dx;
+  if (impact->normaleY != 0) *dy = -*dy;
+}
+
 // ==========================================================
 // FONCTIONS DE MOUVEMENT (Movement functions)
 // ==========================================================
@@ -124,4 +307,152 @@ inline void phys_clampEcranSimple(int* x, int* y, int marge) {
   phys_clampEcran(x, y, marge, marge);
 }
 
+// ==========================================================
+// VIRGULE FIXE 8.8 (Fixed point 8.8)
+// ==========================================================
+// Des vitesses plus fines qu'un pixel par image, sans float:
+// un "fixe" est un int dont les 8 bits du bas sont la partie
+// après la virgule. FIXE_UN = 1 pixel, 128 = un demi-pixel.
+// (Speeds finer than one pixel per frame, without float: a
+// "fixe" is an int whose low 8 bits are the part after the
+// point. FIXE_UN = 1 pixel, 128 = half a pixel.)
+//
+// Un fixe va de -128 à +127,99: assez pour une vitesse, pas
+// pour une position (l'écran fait 128 de large). Une position
+// garde donc son int en pixels + 1 octet de fraction.
+// (A fixe goes from -128 to +127.99: enough for a speed, not
+// for a position - the screen is 128 wide. A position keeps
+// its int in pixels + 1 byte of fraction.)
+//
+// Angles: 1 octet, 256 = un tour (64 = 90°). Le y de l'écran
+// descend: l'angle 64 pointe vers le BAS.
+// (Angles: 1 byte, 256 = one turn. Screen y goes down: angle
+// 64 points DOWN.)
+
+typedef int16_t fixe;
+
+#define FIXE_UN 256
+#define FIXE(v) ((fixe)((v) * FIXE_UN))  // Constante: FIXE(1.5) (Constant)
+
+// Partie entière, arrondie vers le bas (Whole part, rounded down)
+inline int phys_entier(fixe f) {
+  return f >> 8;
+}
+
+// a x b: 16 x 16 bits, puis on garde le milieu
+// (a x b: 16 x 16 bits, keep the middle)
+inline fixe phys_mulFixe(fixe a, fixe b) {
+  return ((int32_t)a * b) >> 8;
+}
+
+// Avancer une position de "vitesse": la fraction s'accumule
+// et déborde dans les pixels
+// (Move a position by "vitesse": the fraction adds up and
+// overflows into the pixels)
+inline void phys_avancerFixe(int* x, uint8_t* fraction, fixe vitesse) {
+  uint16_t somme = *fraction + (uint8_t)vitesse;
+  *x = *x + (vitesse >> 8) + (somme >> 8);
+  *fraction = somme;
+}
+
+// Un corps qui bouge au sous-pixel (A body moving in sub-pixels)
+struct Corps {
+  int x, y;                   // Pixels (pour dessiner) (Pixels - for drawing)
+  uint8_t fractionX, fractionY;
+  fixe vx, vy;                // Pixels par image (Pixels per frame)
+};
+
+inline void phys_avancerCorps(Corps* corps) {
+  phys_avancerFixe(&corps->x, &corps->fractionX, corps->vx);
+  phys_avancerFixe(&corps->y, &corps->fractionY, corps->vy);
+}
+
+// ----------------------------------------------------------
+// Trigonométrie en table (Lookup-table trigonometry)
+// ----------------------------------------------------------
+
+// sin(i) x 256 pour un quart de tour, 255 au plus
+// (sin(i) x 256 for a quarter turn, 255 at most)
+const uint8_t phys_sinTable[64] PROGMEM = {
+  0, 6, 13, 19, 25, 31, 38, 44, 50, 56, 62, 68, 74, 80, 86, 92,
+  98, 104, 109, 115, 121, 126, 132, 137, 142, 147, 152, 157, 162, 167, 172, 177,
+  181, 185, 190, 194, 198, 202, 206, 209, 213, 216, 220, 223, 226, 229, 231, 234,
+  237, 239, 241, 243, 245, 247, 248, 250, 251, 252, 253, 254, 255, 255, 255, 255
+};
+
+// atan(i / 32) en angle d'octet: 0 à 32 (= 45°)
+// (atan(i / 32) as a byte angle: 0 to 32)
+const uint8_t phys_atanTable[33] PROGMEM = {
+  0, 1, 3, 4, 5, 6, 8, 9, 10, 11, 12, 13, 15, 16, 17, 18,
+  19, 20, 21, 22, 23, 24, 25, 25, 26, 27, 28, 29, 29, 30, 31, 31, 32
+};
+
+// Sinus en fixe: -FIXE_UN à FIXE_UN (Sine as a fixe)
+inline fixe phys_sin(uint8_t angle) {
+  uint8_t i = angle & 63;
+  if (angle & 64) i = 64 - i;  // Deuxième quart: miroir (Second quarter: mirror)
+  fixe valeur = i == 64 ? FIXE_UN : pgm_read_byte(&phys_sinTable[i]);
+  return (angle & 128) ? -valeur : valeur;
+}
+
+inline fixe phys_cos(uint8_t angle) {
+  return phys_sin(angle + 64);
+}
+
+// Angle de (0, 0) vers (dx, dy), comme atan2 - une division
+// |dx| et |dy| < 1024. Le calcul est en uint16_t: 1023 * 32 +
+// 511 dépasse un int de l'AVR.
+// (Angle from (0, 0) toward (dx, dy), like atan2 - one
+// division. Computed in uint16_t: 1023 * 32 + 511 overflows an
+// AVR int.)
+inline uint8_t phys_angle(int dx, int dy) {
+  uint16_t ax = dx < 0 ? -dx : dx;
+  uint16_t ay = dy < 0 ? -dy : dy;
+  uint8_t angle;
+  if (ax == 0 && ay == 0) return 0;
+  if (ax >= ay) angle = pgm_read_byte(&phys_atanTable[(uint16_t)((ay << 5) + (ax >> 1)) / ax]);
+  else angle = 64 - pgm_read_byte(&phys_atanTable[(uint16_t)((ax << 5) + (ay >> 1)) / ay]);
+  if (dx < 0) angle = 128 - angle;
+  if (dy < 0) angle = -angle;
+  return angle;
+}
+
+// Vitesse de norme "vitesse" dans la direction "angle"
+// (Velocity of size "vitesse" toward "angle")
+inline void phys_vitesseAngle(uint8_t angle, fixe vitesse, fixe* vx, fixe* vy) {
+  *vx = phys_mulFixe(phys_cos(angle), vitesse);
+  *vy = phys_mulFixe(phys_sin(angle), vitesse);
+}
+
+// ----------------------------------------------------------
+// Racine carrée entière (Integer square root)
+// ----------------------------------------------------------
+
+// Plus grand r tel que r x r <= n, bit par bit: 16 tours, sans
+// multiplication (Largest r with r x r <= n, bit by bit: 16
+// rounds, no multiplication)
+inline uint16_t phys_racine(uint32_t n) {
+  uint32_t resultat = 0;
+  uint32_t bit = 1UL << 30;
+  while (bit > n) bit >>= 2;
+  while (bit != 0) {
+    if (n >= resultat + bit) {
+      n -= resultat + bit;
+      resultat = (resultat >> 1) + bit;
+    } else {
+      resultat >>= 1;
+    }
+    bit >>= 2;
+  }
+  return resultat;
+}
+
+// Vraie distance, arrondie vers le bas (plus lente que phys_distance)
+// (True distance, rounded down - slower than phys_distance)
+inline int phys_distanceExacte(int x1, int y1, int x2, int y2) {
+  int32_t dx = x1 - x2;
+  int32_t dy = y1 - y2;
+  return phys_racine(dx * dx + dy * dy);
+}
+
 #endif
@@ -14,6 +14,8 @@
 #ifndef PROCEDURAL_H
 #define PROCEDURAL_H
 
+#include "Physics.h"  // phys_distance pour les zones interdites
+
 // ==========================================================
 // CONFIGURATION ÉCRAN (Screen configuration)
 // ==========================================================
@@ -24,26 +26,119 @@
 // ==========================================================
 // GÉNÉRATEUR DE NOMBRES (Number generator)
 // ==========================================================
-// On utilise le seed pour créer des nombres "aléatoires"
-// qui sont toujours les mêmes pour le même seed.
-// (We use the seed to create "random" numbers that are
-// always the same for the same seed.)
+// Générateur "à compteur": chaque nombre est calculé à partir
+// de (seed, flux, index) avec une fonction de mélange.
+// Pas d'état caché, pas de division!
+// (Counter-based generator: each number is computed from
+// (seed, stream, index) with a mixing function.
+// No hidden state, no division!)
+//
+// - Même (seed, flux, index) = même nombre, toujours.
+// - Le N-ième nombre se calcule directement: O(1).
+// - Chaque flux est indépendant: les spawns de Monster Hunter
+//   ne changent pas les plateformes d'Aventurier.
+// (- Same (seed, stream, index) = same number, always.
+//  - The Nth number is computed directly: O(1).
+//  - Each stream is independent.)
+
+// Numéros de flux (Stream numbers)
+// Chaque fonction de ce fichier a son propre flux.
+// Les jeux utilisent PROC_FLUX_JEU et plus pour leurs flux à eux.
+// (Each function of this file has its own stream.
+// Games use PROC_FLUX_JEU and above for their own streams.)
+#define PROC_FLUX_GLOBAL 0          // proc_init / proc_random
+#define PROC_FLUX_POSITION 1        // proc_genererPosition
+#define PROC_FLUX_SPAWN 2           // Flux de spawn par défaut (Default spawn stream)
+#define PROC_FLUX_COIN 3            // proc_genererDansCoin
+#define PROC_FLUX_PLATEFORMES 4     // proc_genererPlateformes
+#define PROC_FLUX_SUR_PLATEFORME 5  // proc_genererSurPlateforme
+#define PROC_FLUX_MONDE 6           // proc_mondePas
+#define PROC_FLUX_JEU 16            // Premier flux libre (First free stream)
+
+// Un flux en cours de lecture (A stream being read)
+// Coût: 8 octets, seulement sur la pile (8 bytes, stack only)
+struct ProcFlux {
+  uint32_t cle;       // Clé du flux: seed + numéro de flux (Stream key)
+  uint32_t position;  // Quel nombre on lit maintenant (Which number next)
+};
+
+// Mélanger 32 bits (Mix 32 bits) - "lowbias32"
+// 2 multiplications, que des décalages et XOR sinon.
+// (2 multiplies, otherwise only shifts and XOR.)
+inline uint32_t proc_melanger(uint32_t x) {
+  x ^= x >> 16;
+  x *= 0x7FEB352DUL;
+  x ^= x >> 15;
+  x *= 0x846CA68BUL;
+  x ^= x >> 16;
+  return x;
+}
+
+// Clé d'un flux (Stream key)
+inline uint32_t proc_cleFlux(uint32_t seed, uint8_t flux) {
+  return proc_melanger(seed + (uint32_t)flux * 0x632BE5ABUL);
+}
+
+// Le nombre numéro "position" d'un flux, sur 16 bits
+// (The number at "position" in a stream, 16 bits)
+// La multiplication par une constante impaire donne une entrée
+// différente pour chaque position. (Odd constant = distinct inputs.)
+inline uint16_t proc_valeur(uint32_t cle, uint32_t position) {
+  return (uint16_t)(proc_melanger(cle + position * 0x9E3779B9UL) >> 16);
+}
+
+// Ramener 0..65535 dans [min, max] sans division
+// (Bring 0..65535 into [min, max] without division)
+// On multiplie et on garde les 16 bits du haut.
+// (Multiply and keep the top 16 bits.)
+inline int proc_reduire(uint16_t valeur, int minVal, int maxVal) {
+  if (maxVal <= minVal) return minVal;
+  uint16_t etendue = (uint16_t)(maxVal - minVal + 1);
+  return minVal + (int)(((uint32_t)valeur * etendue) >> 16);
+}
 
-// Seed actuel (Current seed)
-unsigned long proc_seed = 1;
+// Accès direct: (seed, flux, index) -> nombre entre min et max
+// (Direct access: (seed, stream, index) -> number in [min, max])
+//
+// Usage:
+//   int x = proc_hash(niveau, PROC_FLUX_JEU, 7, 0, 127);
+inline int proc_hash(uint32_t seed, uint8_t flux, uint32_t index,
+                     int minVal, int maxVal) {
+  return proc_reduire(proc_valeur(proc_cleFlux(seed, flux), index), minVal, maxVal);
+}
+
+// Ouvrir un flux pour l'élément "index"
+// Chaque élément a 65536 nombres à lui.
+// (Open a stream for element "index" - each element owns
+// 65536 numbers.)
+inline void proc_fluxInit(ProcFlux* f, uint32_t seed, uint8_t flux, uint16_t index) {
+  f->cle = proc_cleFlux(seed, flux);
+  f->position = (uint32_t)index << 16;
+}
+
+// Nombre suivant du flux entre min et max
+// (Next number of the stream between min and max)
+inline int proc_fluxRandom(ProcFlux* f, int minVal, int maxVal) {
+  uint16_t v = proc_valeur(f->cle, f->position);
+  f->position++;
+  return proc_reduire(v, minVal, maxVal);
+}
+
+// Flux global pour les petits usages (Global stream for simple uses)
+// Les fonctions proc_generer* ne l'utilisent PAS!
+// (The proc_generer* functions do NOT use it!)
+ProcFlux proc_global = { 0, 0 };
 
-// Initialiser le générateur avec un seed
-// (Initialize generator with a seed)
+// Initialiser le flux global avec un seed
+// (Initialize the global stream with a seed)
 void proc_init(unsigned long seed) {
-  proc_seed = seed * 1103515245 + 12345;
+  proc_fluxInit(&proc_global, seed, PROC_FLUX_GLOBAL, 0);
 }
 
 // Obtenir un nombre aléatoire entre min et max
 // (Get a random number between min and max)
 int proc_random(int minVal, int maxVal) {
-  proc_seed = proc_seed * 1103515245 + 12345;
-  int result = (proc_seed / 65536) % 32768;
-  return minVal + (result % (maxVal - minVal + 1));
+  return proc_fluxRandom(&proc_global, minVal, maxVal);
 }
 
 // ==========================================================
@@ -68,10 +163,11 @@ int proc_random(int minVal, int maxVal) {
 //   proc_genererPosition(niveau, 0, &foodX, &foodY, 10);
 
 void proc_genererPosition(int seed, int index, int* x, int* y, int marge) {
-  proc_init(seed * 11111 + index * 77777);
+  ProcFlux f;
+  proc_fluxInit(&f, seed, PROC_FLUX_POSITION, index);
   
-  *x = proc_random(marge, PROC_ECRAN_LARGEUR - marge);
-  *y = proc_random(marge, PROC_ECRAN_HAUTEUR - marge);
+  *x = proc_fluxRandom(&f, marge, PROC_ECRAN_LARGEUR - marge);
+  *y = proc_fluxRandom(&f, marge, PROC_ECRAN_HAUTEUR - marge);
 }
 
 // ----------------------------------------------------------
@@ -94,15 +190,237 @@ void proc_genererPositions(int seed, int positions[][2], int nb, int marge) {
   }
 }
 
+// ==========================================================
+// SPAWN SANS REJET (Rejection-free spawning)
+// ==========================================================
+// L'écran est coupé en cellules de 8x8 pixels (16 x 8 = 128).
+// On enlève les cellules interdites (bords, barre de score,
+// autour du joueur, autour des objets déjà posés), puis on
+// choisit DIRECTEMENT une des cellules libres.
+// Pas d'essais ratés: le temps est toujours le même!
+// (The screen is cut into 8x8 cells. Forbidden cells are
+// removed (edges, score bar, around the player, around
+// objects already placed), then one free cell is picked
+// DIRECTLY. No failed tries: time is always the same!)
+//
+// Comme chaque objet posé bloque ses voisins, les objets
+// sont bien espacés ("bruit bleu") au lieu de faire des tas.
+// (Since each placed object blocks its neighbours, objects
+// come out evenly spaced - "blue noise" - instead of clumping.)
+//
+// Coût RAM: 22 octets sur la pile pendant le spawn
+// (RAM cost: 22 bytes on the stack while spawning)
+
+#define PROC_SPAWN_CELLULE 8                                       // Pixels par cellule
+#define PROC_SPAWN_COLONNES (PROC_ECRAN_LARGEUR / PROC_SPAWN_CELLULE)  // 16
+#define PROC_SPAWN_LIGNES (PROC_ECRAN_HAUTEUR / PROC_SPAWN_CELLULE)    // 8
+#define PROC_SPAWN_ESPACEMENT 16                                   // Écart par défaut
+
+// Demi-diagonale d'une cellule: un point n'importe où dans la
+// cellule reste assez loin si son centre l'est.
+// (Half-diagonal of a cell: any point of the cell stays far
+// enough if its centre does.)
+#define PROC_SPAWN_PADDING 6
+
+struct ProcSpawn {
+  uint16_t libres[PROC_SPAWN_LIGNES];  // Bit c = colonne c libre (Bit c = column c free)
+  int8_t marge;       // Distance des bords (Edge margin)
+  int8_t margeHaut;   // Haut réservé à la barre de score (Top reserved for HUD)
+  int8_t loinX;       // Point le plus "important" à fuir (Main point to flee)
+  int8_t loinY;
+  int8_t loinDist;
+};
+
+// Zone autorisée d'une cellule, sur un axe
+// (Allowed range of a cell, on one axis)
+// Retourne false si la cellule est entièrement hors limites.
+inline bool proc_spawnIntervalle(int cellule, int mini, int maxi, int* debut, int* fin) {
+  int d = cellule * PROC_SPAWN_CELLULE;
+  int f = d + PROC_SPAWN_CELLULE - 1;
+  if (d < mini) d = mini;
+  if (f > maxi) f = maxi;
+  *debut = d;
+  *fin = f;
+  return d <= f;
+}
+
+// ----------------------------------------------------------
+// proc_spawnDebut - Toutes les cellules dans les marges
+// (All cells inside the margins)
+// ----------------------------------------------------------
+// marge     - Distance minimum des bords
+// margeHaut - Y minimum (sous la barre de score!)
+
+void proc_spawnDebut(ProcSpawn* zone, int marge, int margeHaut) {
+  zone->marge = marge;
+  zone->margeHaut = margeHaut;
+  zone->loinDist = 0;
+  zone->loinX = PROC_ECRAN_LARGEUR / 2;
+  zone->loinY = PROC_ECRAN_HAUTEUR / 2;
+  
+  // Les colonnes valides sont les mêmes pour chaque ligne
+  // (Valid columns are the same for every row)
+  int d, f;
+  uint16_t colonnes = 0;
+  for (int col = 0; col < PROC_SPAWN_COLONNES; col++) {
+    if (proc_spawnIntervalle(col, marge, PROC_ECRAN_LARGEUR - marge, &d, &f)) {
+      colonnes |= (uint16_t)1 << col;
+    }
+  }
+  
+  for (int ligne = 0; ligne < PROC_SPAWN_LIGNES; ligne++) {
+    bool ok = proc_spawnIntervalle(ligne, margeHaut, PROC_ECRAN_HAUTEUR - marge, &d, &f);
+    zone->libres[ligne] = ok ? colonnes : 0;
+  }
+}
+
+// ----------------------------------------------------------
+// proc_spawnEviter - Interdire un disque autour d'un point
+// (Forbid a disk around a point)
+// ----------------------------------------------------------
+// Pour le joueur (grand disque) ou un objet déjà placé.
+// (For the player (big disk) or an object already placed.)
+
+void proc_spawnEviter(ProcSpawn* zone, int x, int y, int distance) {
+  if (distance > zone->loinDist) {
+    zone->loinX = x;
+    zone->loinY = y;
+    zone->loinDist = distance;
+  }
+  
+  int rayon = distance + PROC_SPAWN_PADDING;
+  
+  // Seulement les cellules dans la boîte du disque
+  // (Only cells inside the disk's bounding box)
+  int ligneMin = (y - rayon) / PROC_SPAWN_CELLULE;
+  int ligneMax = (y + rayon) / PROC_SPAWN_CELLULE;
+  int colMin = (x - rayon) / PROC_SPAWN_CELLULE;
+  int colMax = (x + rayon) / PROC_SPAWN_CELLULE;
+  if (ligneMin < 0) ligneMin = 0;
+  if (colMin < 0) colMin = 0;
+  if (ligneMax > PROC_SPAWN_LIGNES - 1) ligneMax = PROC_SPAWN_LIGNES - 1;
+  if (colMax > PROC_SPAWN_COLONNES - 1) colMax = PROC_SPAWN_COLONNES - 1;
+  
+  for (int ligne = ligneMin; ligne <= ligneMax; ligne++) {
+    int cy = ligne * PROC_SPAWN_CELLULE + PROC_SPAWN_CELLULE / 2;
+    for (int col = colMin; col <= colMax; col++) {
+      int cx = col * PROC_SPAWN_CELLULE + PROC_SPAWN_CELLULE / 2;
+      if (phys_distance(cx, cy, x, y) < rayon) {
+        zone->libres[ligne] &= ~((uint16_t)1 << col);
+      }
+    }
+  }
+}
+
+// Compter les cellules libres (Count free cells)
+int proc_spawnCompter(ProcSpawn* zone) {
+  int compte = 0;
+  for (int ligne = 0; ligne < PROC_SPAWN_LIGNES; ligne++) {
+    uint16_t bits = zone->libres[ligne];
+    while (bits) {
+      bits &= bits - 1;  // Enlever le bit le plus bas (Clear lowest bit)
+      compte++;
+    }
+  }
+  return compte;
+}
+
+// ----------------------------------------------------------
+// proc_spawnChoisir - Choisir une position libre
+// (Pick a free position)
+// ----------------------------------------------------------
+// Paramètres:
+//   seed, index - Même seed + index = même position
+//   flux        - Un flux par sorte d'objet (PROC_FLUX_SPAWN,
+//                 PROC_FLUX_JEU + n): sinon la Nième nourriture
+//                 et le Nième monstre tirent les mêmes nombres!
+//                 (One stream per kind of object: otherwise the
+//                 Nth food and the Nth monster draw the same
+//                 numbers!)
+//   x, y        - Pointeurs pour le résultat
+//   espacement  - Disque à bloquer autour du point choisi
+//                 (0 = rien, pour un seul objet)
+//
+// Retourne false si la zone était pleine: la position est
+// alors le coin opposé au point principal à éviter.
+// (Returns false if the zone was full: the position is then
+// the corner opposite to the main avoided point.)
+
+bool proc_spawnChoisir(ProcSpawn* zone, int seed, uint8_t flux, int index,
+                       int* x, int* y, int espacement) {
+  int libres = proc_spawnCompter(zone);
+  
+  if (libres == 0) {
+    // Fallback: coin opposé (Fallback: opposite corner)
+    int marge = zone->marge;
+    *x = (zone->loinX < PROC_ECRAN_LARGEUR / 2) ? PROC_ECRAN_LARGEUR - marge - 10 : marge + 10;
+    *y = (zone->loinY < PROC_ECRAN_HAUTEUR / 2) ? PROC_ECRAN_HAUTEUR - marge - 10 : zone->margeHaut + 10;
+    return false;
+  }
+  
+  ProcFlux f;
+  proc_fluxInit(&f, seed, flux, index);
+  int choix = proc_fluxRandom(&f, 0, libres - 1);
+  
+  // Trouver la cellule libre numéro "choix" (Find free cell number "choix")
+  for (int ligne = 0; ligne < PROC_SPAWN_LIGNES; ligne++) {
+    uint16_t bits = zone->libres[ligne];
+    for (int col = 0; bits; col++, bits >>= 1) {
+      if (bits & 1) {
+        if (choix == 0) {
+          // Position au hasard dans la cellule (Random spot in the cell)
+          int d, fin;
+          proc_spawnIntervalle(col, zone->marge, PROC_ECRAN_LARGEUR - zone->marge, &d, &fin);
+          *x = proc_fluxRandom(&f, d, fin);
+          proc_spawnIntervalle(ligne, zone->margeHaut, PROC_ECRAN_HAUTEUR - zone->marge, &d, &fin);
+          *y = proc_fluxRandom(&f, d, fin);
+          
+          if (espacement > 0) {
+            proc_spawnEviter(zone, *x, *y, espacement);
+          }
+          return true;
+        }
+        choix--;
+      }
+    }
+  }
+  return false;  // Jamais atteint (Never reached)
+}
+
+// ----------------------------------------------------------
+// proc_genererPositionsEspacees - Un ensemble bien espacé
+// (An evenly spaced set)
+// ----------------------------------------------------------
+// Comme proc_genererPositions, mais les objets ne se collent
+// jamais: parfait pour nourriture, pièces, bonus.
+// (Like proc_genererPositions, but objects never clump:
+// perfect for food, coins, pickups.)
+//
+// Usage:
+//   int pieces[4][2];
+//   proc_genererPositionsEspacees(niveau, PROC_FLUX_SPAWN, pieces, 4, 10, 12, 20);
+
+void proc_genererPositionsEspacees(int seed, uint8_t flux, int positions[][2], int nb,
+                                   int marge, int margeHaut, int espacement) {
+  ProcSpawn zone;
+  proc_spawnDebut(&zone, marge, margeHaut);
+  for (int i = 0; i < nb; i++) {
+    proc_spawnChoisir(&zone, seed, flux, i, &positions[i][0], &positions[i][1], espacement);
+  }
+}
+
 // ----------------------------------------------------------
 // proc_genererLoinDe - Position loin d'un point donné
 // (Position far from a given point)
 // ----------------------------------------------------------
 // Parfait pour spawner des monstres loin du joueur!
 // (Perfect for spawning monsters far from player!)
+// Utilise le spawn sans rejet: toujours le même temps.
+// (Uses rejection-free spawning: always the same time.)
 //
 // Paramètres:
 //   seed     - Graine pour la génération
+//   flux     - Flux de l'objet (Object stream, see proc_spawnChoisir)
 //   index    - Numéro de l'élément
 //   x, y     - Pointeurs pour le résultat
 //   eviterX  - Position X à éviter (joueur)
@@ -112,46 +430,15 @@ void proc_genererPositions(int seed, int positions[][2], int nb, int marge) {
 //
 // Usage:
 //   int monstreX, monstreY;
-//   proc_genererLoinDe(niveau, 0, &monstreX, &monstreY,
+//   proc_genererLoinDe(niveau, PROC_FLUX_SPAWN, 0, &monstreX, &monstreY,
 //                      joueurX, joueurY, 40, 10);
 
-void proc_genererLoinDe(int seed, int index, int* x, int* y,
+void proc_genererLoinDe(int seed, uint8_t flux, int index, int* x, int* y,
                         int eviterX, int eviterY, int distMin, int marge) {
-  proc_init(seed * 54321 + index * 12345);
-  
-  int essais = 0;
-  int maxEssais = 20;
-  
-  do {
-    *x = proc_random(marge, PROC_ECRAN_LARGEUR - marge);
-    *y = proc_random(marge, PROC_ECRAN_HAUTEUR - marge);
-    
-    // Calculer distance (Calculate distance)
-    int dx = *x - eviterX;
-    int dy = *y - eviterY;
-    if (dx < 0) dx = -dx;
-    if (dy < 0) dy = -dy;
-    int distance = dx + dy;  // Distance Manhattan
-    
-    if (distance >= distMin) {
-      return;  // Position valide trouvée!
-    }
-    
-    essais++;
-  } while (essais < maxEssais);
-  
-  // Fallback: coin opposé au joueur
-  // (Fallback: corner opposite to player)
-  if (eviterX < PROC_ECRAN_LARGEUR / 2) {
-    *x = PROC_ECRAN_LARGEUR - marge - 10;
-  } else {
-    *x = marge + 10;
-  }
-  if (eviterY < PROC_ECRAN_HAUTEUR / 2) {
-    *y = PROC_ECRAN_HAUTEUR - marge - 10;
-  } else {
-    *y = marge + 10;
-  }
+  ProcSpawn zone;
+  proc_spawnDebut(&zone, marge, marge);
+  proc_spawnEviter(&zone, eviterX, eviterY, distMin);
+  proc_spawnChoisir(&zone, seed, flux, index, x, y, 0);
 }
 
 // ----------------------------------------------------------
@@ -172,26 +459,27 @@ void proc_genererLoinDe(int seed, int index, int* x, int* y,
 //   proc_genererDansCoin(niveau, 0, &enemyX, &enemyY, 25);
 
 void proc_genererDansCoin(int seed, int index, int* x, int* y, int marge) {
-  proc_init(seed * 99999 + index * 33333);
+  ProcFlux f;
+  proc_fluxInit(&f, seed, PROC_FLUX_COIN, index);
   
-  int coin = proc_random(0, 3);
+  int coin = proc_fluxRandom(&f, 0, 3);
   
   if (coin == 0) {
     // Haut-gauche (Top-left)
-    *x = proc_random(5, marge);
-    *y = proc_random(12, marge);
+    *x = proc_fluxRandom(&f, 5, marge);
+    *y = proc_fluxRandom(&f, 12, marge);
   } else if (coin == 1) {
     // Haut-droite (Top-right)
-    *x = proc_random(PROC_ECRAN_LARGEUR - marge, PROC_ECRAN_LARGEUR - 5);
-    *y = proc_random(12, marge);
+    *x = proc_fluxRandom(&f, PROC_ECRAN_LARGEUR - marge, PROC_ECRAN_LARGEUR - 5);
+    *y = proc_fluxRandom(&f, 12, marge);
   } else if (coin == 2) {
     // Bas-gauche (Bottom-left)
-    *x = proc_random(5, marge);
-    *y = proc_random(PROC_ECRAN_HAUTEUR - marge, PROC_ECRAN_HAUTEUR - 5);
+    *x = proc_fluxRandom(&f, 5, marge);
+    *y = proc_fluxRandom(&f, PROC_ECRAN_HAUTEUR - marge, PROC_ECRAN_HAUTEUR - 5);
   } else {
     // Bas-droite (Bottom-right)
-    *x = proc_random(PROC_ECRAN_LARGEUR - marge, PROC_ECRAN_LARGEUR - 5);
-    *y = proc_random(PROC_ECRAN_HAUTEUR - marge, PROC_ECRAN_HAUTEUR - 5);
+    *x = proc_fluxRandom(&f, PROC_ECRAN_LARGEUR - marge, PROC_ECRAN_LARGEUR - 5);
+    *y = proc_fluxRandom(&f, PROC_ECRAN_HAUTEUR - marge, PROC_ECRAN_HAUTEUR - 5);
   }
 }
 
@@ -248,7 +536,8 @@ bool proc_sautPossible(int deltaX, int deltaY, int difficulte) {
 //   int dernierY = proc_genererPlateformes(niveau, plat, 5, 1);
 
 int proc_genererPlateformes(int niveau, int plat[][3], int nbPlat, int difficulte) {
-  proc_init(niveau * 12345);
+  ProcFlux f;
+  proc_fluxInit(&f, niveau, PROC_FLUX_PLATEFORMES, 0);
   
   // Plateformes plus larges pour niveaux faciles
   int largeurMin = 30;
@@ -278,11 +567,11 @@ int proc_genererPlateformes(int niveau, int plat[][3], int nbPlat, int difficult
     
     do {
       // Distances plus conservatrices
-      deltaX = proc_random(10, 25);
-      deltaY = proc_random(4, PROC_SAUT_MAX_Y);
+      deltaX = proc_fluxRandom(&f, 10, 25);
+      deltaY = proc_fluxRandom(&f, 4, PROC_SAUT_MAX_Y);
       
       // Favorise mouvement vers la droite (60%)
-      int direction = proc_random(0, 100);
+      int direction = proc_fluxRandom(&f, 0, 100);
       if (direction < 30 && dernierX > 30) {
         // Gauche: seulement si on n'est pas trop à gauche
         nouveauX = dernierX - deltaX;
@@ -292,7 +581,7 @@ int proc_genererPlateformes(int niveau, int plat[][3], int nbPlat, int difficult
       }
       
       nouveauY = dernierY - deltaY;
-      largeur = proc_random(largeurMin, largeurMax);
+      largeur = proc_fluxRandom(&f, largeurMin, largeurMax);
       
       // Contraintes d'écran avec marges
       if (nouveauX < 5) nouveauX = 5;
@@ -323,12 +612,12 @@ int proc_genererPlateformes(int niveau, int plat[][3], int nbPlat, int difficult
       
       // Fallback après plusieurs essais: position proche et facile
       if (essais > 15) {
-        nouveauX = dernierX + proc_random(-15, 20);
+        nouveauX = dernierX + proc_fluxRandom(&f, -15, 20);
         if (nouveauX < 5) nouveauX = 5;
         if (nouveauX > PROC_ECRAN_LARGEUR - largeur - 5) {
           nouveauX = PROC_ECRAN_LARGEUR - largeur - 5;
         }
-        nouveauY = dernierY - proc_random(4, 8);
+        nouveauY = dernierY - proc_fluxRandom(&f, 4, 8);
         if (nouveauY < 12) nouveauY = 12;
         sautValide = true;  // Force acceptation
       }
@@ -379,19 +668,164 @@ void proc_genererPorte(int plat[][3], int nbPlat, int* porteX, int* porteY) {
 
 void proc_genererSurPlateforme(int seed, int index, int plat[][3], int nbPlat,
                                 int* x, int* y, int hauteur) {
-  proc_init(seed * 54321 + index * 11111);
+  ProcFlux f;
+  proc_fluxInit(&f, seed, PROC_FLUX_SUR_PLATEFORME, index);
   
   // Choisir plateforme (pas la première = spawn)
-  int indexPlat = proc_random(1, nbPlat - 1);
+  int indexPlat = proc_fluxRandom(&f, 1, nbPlat - 1);
   
   int px = plat[indexPlat][0];
   int py = plat[indexPlat][1];
   int pl = plat[indexPlat][2];
   
-  *x = px + proc_random(5, pl - 5);
+  *x = px + proc_fluxRandom(&f, 5, pl - 5);
   *y = py - hauteur;
 }
 
+// ----------------------------------------------------------
+// Mondes qui défilent (Scrolling worlds)
+// ----------------------------------------------------------
+// Un monde = une suite de MORCEAUX de 32 pixels, une
+// plateforme par morceau, toujours vers la droite. On les
+// fabrique un par un, juste avant que la caméra arrive.
+// (A world = a row of 32-pixel CHUNKS, one platform per
+// chunk, always moving right. They are built one by one,
+// just before the camera gets there.)
+//
+// Pas d'essais: l'écart et la montée sont tirés DANS les
+// limites d'un saut possible. Chaque morceau coûte 3 tirages,
+// toujours - jamais d'image plus lente que les autres.
+// (No retries: the gap and climb are drawn INSIDE the limits
+// of a possible jump. Every chunk costs 3 draws, always -
+// never a frame slower than the others.)
+//
+// Usage:
+//   ProcMonde monde;
+//   proc_mondeDebut(&monde, niveau, proc_mondeNbMorceaux(niveau), difficulte);
+//   while (proc_mondePas(&monde)) {
+//     // Morceau monde.suivant - 1, plateforme x (relatif au
+//     // morceau), y, largeur (x is relative to the chunk)
+//   }
+
+#define PROC_MORCEAU_LARGEUR 32      // Pixels par morceau (Pixels per chunk)
+#define PROC_MORCEAU_BITS 5          // x >> 5 = numéro du morceau (chunk number)
+#define PROC_MORCEAU_DECALAGE_MAX 12 // x relatif max dans un morceau (Max relative x)
+#define PROC_MONDE_MORCEAUX_MAX 64   // 16 écrans (16 screens)
+#define PROC_MONDE_ECART_MIN 4       // Trou minimum entre plateformes (Min gap)
+#define PROC_MONDE_HAUT 20           // Plateforme la plus haute (Highest platform)
+#define PROC_MONDE_BAS 50            // Plateforme la plus basse (Lowest platform)
+
+struct ProcMonde {
+  ProcFlux f;
+  int suivant;           // Prochain morceau à fabriquer (Next chunk to build)
+  int nbMorceaux;
+  int8_t difficulte;
+  int8_t largeurMin;
+  int8_t largeurMax;
+  int8_t ecartMax;       // Trou maximum (Max gap)
+  int finX;              // Bord droit de la plateforme précédente (Previous right edge)
+  int8_t x;              // Morceau fabriqué par le dernier pas,
+  int8_t y;              // x relatif au début du morceau
+  int8_t largeur;        // (Chunk built by the last step, x relative to the chunk)
+};
+
+// Longueur du monde: 2 écrans au niveau 6, +1 écran tous les 3 niveaux
+// (World length: 2 screens at level 6, +1 screen every 3 levels)
+int proc_mondeNbMorceaux(int niveau) {
+  int morceaux = 8 + ((niveau - 6) / 3) * 4;
+  if (morceaux < 8) morceaux = 8;
+  if (morceaux > PROC_MONDE_MORCEAUX_MAX) morceaux = PROC_MONDE_MORCEAUX_MAX;
+  return morceaux;
+}
+
+// Montée maximum pour un trou donné (Max climb for a given gap)
+inline int proc_mondeMonteeMax(int ecart, int difficulte) {
+  if (proc_sautPossible(ecart, PROC_SAUT_MAX_Y, difficulte)) return PROC_SAUT_MAX_Y;
+  if (proc_sautPossible(ecart, 10, difficulte)) return 10;
+  if (proc_sautPossible(ecart, 6, difficulte)) return 6;
+  return 0;
+}
+
+// Préparer un monde (Prepare a world)
+void proc_mondeDebut(ProcMonde* m, int niveau, int nbMorceaux, int difficulte) {
+  proc_fluxInit(&m->f, niveau, PROC_FLUX_MONDE, 0);
+  m->suivant = 0;
+  m->nbMorceaux = nbMorceaux;
+  m->difficulte = difficulte;
+  
+  // largeurMin + ecartMax >= 32: le prochain morceau a toujours
+  // une place valide (the next chunk always has a valid spot)
+  m->largeurMin = 20;
+  m->largeurMax = 28;
+  m->ecartMax = 16;
+  if (difficulte == 2) {
+    m->largeurMin = 18;
+    m->largeurMax = 26;
+    m->ecartMax = 18;
+  } else if (difficulte >= 3) {
+    m->largeurMin = 14;
+    m->largeurMax = 22;
+    m->ecartMax = 20;
+  }
+}
+
+// Le monde est-il complet? (Is the world complete?)
+inline bool proc_mondeTermine(ProcMonde* m) {
+  return m->suivant >= m->nbMorceaux;
+}
+
+// Fabriquer le morceau suivant dans m->x, m->y, m->largeur
+// Retourne false si tous les morceaux sont déjà faits.
+// (Build the next chunk into m->x, m->y, m->largeur.
+// Returns false if every chunk is already done.)
+bool proc_mondePas(ProcMonde* m) {
+  if (proc_mondeTermine(m)) return false;
+  
+  if (m->suivant == 0) {
+    // Premier morceau: le départ (First chunk: the start)
+    m->x = 0;
+    m->y = 56;
+    m->largeur = 30;
+    m->finX = 30;
+    m->suivant = 1;
+    return true;
+  }
+  
+  int debut = m->suivant << PROC_MORCEAU_BITS;
+  int largeur = proc_fluxRandom(&m->f, m->largeurMin, m->largeurMax);
+  
+  // Place possible dans le morceau, trou entre ECART_MIN et ecartMax
+  // (Possible spots in the chunk, gap between ECART_MIN and ecartMax)
+  int xMin = m->finX + PROC_MONDE_ECART_MIN - debut;
+  int xMax = m->finX + m->ecartMax - debut;
+  if (xMin < 0) xMin = 0;
+  if (xMax > PROC_MORCEAU_DECALAGE_MAX) xMax = PROC_MORCEAU_DECALAGE_MAX;
+  int x = proc_fluxRandom(&m->f, xMin, xMax);
+  
+  // Monter seulement si le trou le permet (Climb only if the gap allows)
+  int ecart = debut + x - m->finX;
+  int yMin = m->y - proc_mondeMonteeMax(ecart, m->difficulte);
+  int yMax = m->y + PROC_SAUT_MAX_Y;
+  if (yMin < PROC_MONDE_HAUT) yMin = PROC_MONDE_HAUT;
+  if (yMax > PROC_MONDE_BAS) yMax = PROC_MONDE_BAS;
+  if (yMin > yMax) yMin = yMax;
+  int y = proc_fluxRandom(&m->f, yMin, yMax);
+  
+  m->x = x;
+  m->y = y;
+  m->largeur = largeur;
+  m->finX = debut + x + largeur;
+  m->suivant++;
+  return true;
+}
+
+// Porte sur le dernier morceau, en coordonnées du monde
+// (Door on the last chunk, in world coordinates)
+inline void proc_mondePorte(ProcMonde* m, int* porteX, int* porteY) {
+  *porteX = ((m->suivant - 1) << PROC_MORCEAU_BITS) + m->x + m->largeur / 2;
+  *porteY = m->y - 14;
+}
+
 // ==========================================================
 // SECTION 3: UTILITAIRES (Utilities)
 // ==========================================================
@@ -408,4 +842,246 @@ int proc_calculerDifficulte(int niveau) {
   return 3;
 }
 
+// ==========================================================
+// SECTION 4: BRUIT (Noise)
+// ==========================================================
+// Du hasard LISSE: les valeurs voisines se ressemblent. Parfait
+// pour des collines, un plafond de caverne ou une texture de
+// fond, calculés colonne par colonne quand on en a besoin.
+// (SMOOTH randomness: neighbouring values look alike. Perfect
+// for hills, a cave ceiling or a background texture, computed
+// column by column when needed.)
+//
+// Bruit "de valeurs": chaque coin de la grille reçoit un
+// nombre 0-255 (table de permutation en PROGMEM), et on
+// mélange les coins avec une courbe douce.
+// Que des entiers 8 bits x 8 bits: le multiplicateur de
+// l'AVR fait chaque produit en 2 cycles.
+// (Value noise: each grid corner gets a 0-255 number from a
+// PROGMEM permutation table, and corners are blended with a
+// smooth curve. Only 8-bit x 8-bit integers: the AVR's
+// multiplier does each product in 2 cycles.)
+//
+// Coordonnées en virgule fixe 8.8: l'octet du haut = la case,
+// l'octet du bas = la position dans la case (0-255).
+// (8.8 fixed-point coordinates: high byte = cell, low byte =
+// position inside the cell.)
+//
+// Usage:
+//   uint8_t graine = proc_bruitGraine(niveau, PROC_FLUX_JEU);
+//   for (int col = 0; col < 128; col++) {
+//     int sol = proc_ligneBruit(cameraX + col, graine, 5, 40, 60);
+//     dessinerLigne(col, sol, col, 63);   // Collines (Hills)
+//   }
+
+// Permutation de Ken Perlin: 256 octets en Flash, 0 en RAM
+// (Ken Perlin's permutation: 256 bytes in Flash, 0 in RAM)
+const uint8_t proc_permutation[256] PROGMEM = {
+  151, 160, 137,  91,  90,  15, 131,  13, 201,  95,  96,  53, 194, 233,   7, 225,
+  140,  36, 103,  30,  69, 142,   8,  99,  37, 240,  21,  10,  23, 190,   6, 148,
+  247, 120, 234,  75,   0,  26, 197,  62,  94, 252, 219, 203, 117,  35,  11,  32,
+   57, 177,  33,  88, 237, 149,  56,  87, 174,  20, 125, 136, 171, 168,  68, 175,
+   74, 165,  71, 134, 139,  48,  27, 166,  77, 146, 158, 231,  83, 111, 229, 122,
+   60, 211, 133, 230, 220, 105,  92,  41,  55,  46, 245,  40, 244, 102, 143,  54,
+   65,  25,  63, 161,   1, 216,  80,  73, 209,  76, 132, 187, 208,  89,  18, 169,
+  200, 196, 135, 130, 116, 188, 159,  86, 164, 100, 109, 198, 173, 186,   3,  64,
+   52, 217, 226, 250, 124, 123,   5, 202,  38, 147, 118, 126, 255,  82,  85, 212,
+  207, 206,  59, 227,  47,  16,  58,  17, 182, 189,  28,  42, 223, 183, 170, 213,
+  119, 248, 152,   2,  44, 154, 163,  70, 221, 153, 101, 155, 167,  43, 172,   9,
+  129,  22,  39, 253,  19,  98, 108, 110,  79, 113, 224, 232, 178, 185, 112, 104,
+  218, 246,  97, 228, 251,  34, 242, 193, 238, 210, 144,  12, 191, 179, 162, 241,
+   81,  51, 145, 235, 249,  14, 239, 107,  49, 192, 214,  31, 181, 199, 106, 157,
+  184,  84, 204, 176, 115, 121,  50,  45, 127,   4, 150, 254, 138, 236, 205,  93,
+  222, 114,  67,  29,  24,  72, 243, 141, 128, 195,  78,  66, 215,  61, 156, 180
+};
+
+inline uint8_t proc_perm(uint8_t i) {
+  return pgm_read_byte(&proc_permutation[i]);
+}
+
+// Graine 8 bits pour le bruit, tirée d'un seed de niveau
+// (8-bit noise seed from a level seed)
+inline uint8_t proc_bruitGraine(int seed, uint8_t flux) {
+  return (uint8_t)proc_cleFlux(seed, flux);
+}
+
+// Valeur d'un coin de la grille (Value of a grid corner)
+inline uint8_t proc_coin1D(uint8_t c, uint8_t graine) {
+  return proc_perm(c + graine);
+}
+
+inline uint8_t proc_coin2D(uint8_t caseX, uint8_t caseY, uint8_t graine) {
+  return proc_perm(proc_perm(caseX + graine) + caseY);
+}
+
+// Courbe douce 3t² - 2t³, t et résultat sur 0-255
+// (Smooth curve, t and result on 0-255)
+inline uint8_t proc_lisser(uint8_t t) {
+  uint8_t t2 = ((uint16_t)t * t) >> 8;
+  uint8_t t3 = ((uint16_t)t2 * t) >> 8;
+  uint16_t s = 3 * t2 - 2 * t3;
+  return s > 255 ? 255 : (uint8_t)s;  // Arrondi: 256 possible à t=255
+}
+
+// Mélange de a vers b, t sur 0-255 (Blend from a to b)
+// Produit non signé 8x8: pas de débordement sur 16 bits
+// (Unsigned 8x8 product: no 16-bit overflow)
+inline uint8_t proc_melangerLin(uint8_t a, uint8_t b, uint8_t t) {
+  if (b >= a) {
+    return a + (uint8_t)(((uint16_t)(uint8_t)(b - a) * t) >> 8);
+  }
+  return a - (uint8_t)(((uint16_t)(uint8_t)(a - b) * t) >> 8);
+}
+
+// ----------------------------------------------------------
+// proc_bruit1D / proc_bruit2D - Bruit lisse 0-255
+// (Smooth noise 0-255)
+// ----------------------------------------------------------
+// x, y en 8.8: x = 256 avance d'une case (x = 256 moves one cell)
+
+uint8_t proc_bruit1D(uint16_t x, uint8_t graine) {
+  uint8_t c = x >> 8;
+  uint8_t t = proc_lisser((uint8_t)x);
+  return proc_melangerLin(proc_coin1D(c, graine), proc_coin1D(c + 1, graine), t);
+}
+
+uint8_t proc_bruit2D(uint16_t x, uint16_t y, uint8_t graine) {
+  uint8_t cx = x >> 8;
+  uint8_t cy = y >> 8;
+  uint8_t tx = proc_lisser((uint8_t)x);
+  uint8_t ty = proc_lisser((uint8_t)y);
+  
+  uint8_t haut = proc_melangerLin(proc_coin2D(cx, cy, graine), proc_coin2D(cx + 1, cy, graine), tx);
+  uint8_t bas = proc_melangerLin(proc_coin2D(cx, cy + 1, graine), proc_coin2D(cx + 1, cy + 1, graine), tx);
+  return proc_melangerLin(haut, bas, ty);
+}
+
+// ----------------------------------------------------------
+// proc_bruitFractal1D - Plusieurs octaves additionnées
+// (Several octaves added together)
+// ----------------------------------------------------------
+// Octave 1: grandes collines. Chaque octave suivante est 2x
+// plus serrée et 2x plus faible: des détails sur les collines.
+// Poids 1/2, 1/4, ... et la dernière reprend le poids d'avant
+// pour que le total fasse 1: pas de division!
+// (Octave 1: big hills. Each next octave is 2x tighter and 2x
+// weaker: details on the hills. Weights 1/2, 1/4, ... and the
+// last one repeats the previous weight so the total is 1: no
+// division!)
+// Résultat 0-255 (Result 0-255)
+
+uint8_t proc_bruitFractal1D(uint16_t x, uint8_t graine, uint8_t octaves) {
+  uint8_t somme = 0;
+  for (uint8_t o = 0; o < octaves; o++) {
+    uint8_t decalage = (o == octaves - 1) ? o : o + 1;
+    somme += proc_bruit1D(x, graine + o * 31) >> decalage;
+    x <<= 1;
+  }
+  return somme;
+}
+
+// ----------------------------------------------------------
+// Usages prêts (Ready-made uses)
+// ----------------------------------------------------------
+
+// Hauteur d'une ligne (sol, plafond) pour une colonne du monde
+// pas: 5 = une colline tous les 32 pixels, 6 = 64 pixels...
+// (Height of a line (ground, ceiling) for a world column
+// pas: 5 = one hill every 32 pixels, 6 = 64 pixels...)
+//
+//   int sol = proc_ligneBruit(colonne, graine, 5, 40, 60);
+//   int plafond = proc_ligneBruit(colonne, graine + 1, 4, 0, 16);
+int proc_ligneBruit(int colonne, uint8_t graine, uint8_t pas, int yMin, int yMax) {
+  uint16_t x = (uint16_t)colonne << (8 - pas);
+  uint8_t v = proc_bruitFractal1D(x, graine, 3);
+  return yMin + (int)(((uint16_t)v * (uint16_t)(yMax - yMin + 1)) >> 8);
+}
+
+// Texture de fond: ce pixel est-il allumé? (Background texture: is this pixel lit?)
+// densite: 0 = rien, 255 = presque tout (0 = nothing, 255 = almost everything)
+inline bool proc_texture(int x, int y, uint8_t graine, uint8_t pas, uint8_t densite) {
+  return proc_bruit2D((uint16_t)x << (8 - pas), (uint16_t)y << (8 - pas), graine) < densite;
+}
+
+// ==========================================================
+// SECTION 5: FONDS (Backgrounds)
+// ==========================================================
+// Des étoiles ou des cailloux DERRIÈRE le jeu, sans les garder
+// en mémoire: on les recalcule à chaque page de l'écran.
+// (Stars or pebbles BEHIND the game, without storing them:
+// they are recomputed for every page of the screen.)
+//
+// Le monde est coupé en cases de 8x8. Chaque case a AU PLUS
+// un point, placé par la table de permutation. Pour une page
+// de 8 lignes, on regarde ~17 cases (34 si décalage vertical)
+// et on écrit les points directement dans le buffer de page.
+// 0 octet de RAM, ~4 lectures PROGMEM par case.
+// (The world is cut into 8x8 cells. Each cell has AT MOST one
+// dot, placed by the permutation table. For an 8-row page,
+// ~17 cells are checked (34 with vertical offset) and dots are
+// written straight into the page buffer. 0 bytes of RAM, ~4
+// PROGMEM reads per cell.)
+//
+// Usage (dans DESSINER_ECRAN, AVANT le reste):
+//   proc_fondPage(tamponPage(), numeroPage(),
+//                 proc_bruitGraine(niveau, PROC_FLUX_JEU),
+//                 cameraX / 2, 0, 40);      // Parallaxe!
+
+#define PROC_FOND_CELLULE_BITS 3   // Cases de 8x8 (8x8 cells)
+
+// Le point d'une case: true s'il existe, position dans *px, *py (0-7)
+// (The dot of a cell: true if it exists, position in *px, *py)
+inline bool proc_fondPoint(int caseX, int caseY, uint8_t graine, uint8_t densite,
+                           uint8_t* px, uint8_t* py) {
+  uint8_t a = proc_perm((uint8_t)caseX + graine);
+  a = proc_perm(a + (uint8_t)(caseX >> 8));
+  a = proc_perm(a + (uint8_t)caseY);
+  if (a >= densite) return false;
+  
+  uint8_t b = proc_perm(a + 101);
+  *px = b & 7;
+  *py = (b >> 3) & 7;
+  return true;
+}
+
+// ----------------------------------------------------------
+// proc_fondPage - Dessiner le fond dans UNE page
+// (Draw the background into ONE page)
+// ----------------------------------------------------------
+// Paramètres:
+//   tampon    - Buffer de la page: 128 octets, bit 0 = ligne du haut
+//   page      - Numéro de page 0-7 (lignes page*8 à page*8+7)
+//   graine    - Même graine = même ciel (Same seed = same sky)
+//   decalageX - Défilement (Scroll): cameraX, cameraX / 2...
+//   decalageY - Défilement vertical (Vertical scroll)
+//   densite   - 0 = rien, 255 = un point par case (one dot per cell)
+//   yHaut, yBas - Bande de l'écran à remplir (Screen band to fill)
+
+void proc_fondPage(uint8_t* tampon, uint8_t page, uint8_t graine,
+                   int decalageX, int decalageY, uint8_t densite,
+                   int yHaut = 0, int yBas = PROC_ECRAN_HAUTEUR - 1) {
+  int haut = page << 3;
+  if (haut > yBas || haut + 7 < yHaut) return;  // Page hors bande
+  
+  int premiereX = decalageX >> PROC_FOND_CELLULE_BITS;
+  int derniereX = (decalageX + PROC_ECRAN_LARGEUR - 1) >> PROC_FOND_CELLULE_BITS;
+  int premiereY = (haut + decalageY) >> PROC_FOND_CELLULE_BITS;
+  int derniereY = (haut + 7 + decalageY) >> PROC_FOND_CELLULE_BITS;
+  
+  for (int cy = premiereY; cy <= derniereY; cy++) {
+    for (int cx = premiereX; cx <= derniereX; cx++) {
+      uint8_t px, py;
+      if (!proc_fondPoint(cx, cy, graine, densite, &px, &py)) continue;
+      
+      // Position sur l'écran (Position on screen)
+      int x = (cx << PROC_FOND_CELLULE_BITS) + px - decalageX;
+      int y = (cy << PROC_FOND_CELLULE_BITS) + py - decalageY;
+      if (x < 0 || x >= PROC_ECRAN_LARGEUR) continue;
+      if (y < haut || y > haut + 7 || y < yHaut || y > yBas) continue;
+      
+      tampon[x] |= 1 << (y - haut);
+    }
+  }
+}
+
 #endif
@@ -46,6 +46,136 @@
 #define SPRITE_PROGMEM(nom, ...) DONNEES_BYTE(nom, __VA_ARGS__)
 #define CONFIG_PROGMEM(nom, ...) DONNEES_BYTE(nom, __VA_ARGS__)
 
+// Plateformes: une struct au lieu de 3 octets sans nom
+// (Platforms: a struct instead of 3 unnamed bytes)
+// Même disposition que NIVEAU_PROGMEM {x, y, largeur, ...}
+// (Same layout as NIVEAU_PROGMEM)
+struct PmPlateforme {
+  uint8_t x;
+  uint8_t y;
+  uint8_t largeur;
+};
+
+#define PLATEFORMES_PROGMEM(nom, ...) \
+  const PmPlateforme nom[] PROGMEM = __VA_ARGS__
+
+// ==========================================================
+// LECTURE TYPÉE (Typed reads)
+// ==========================================================
+// pm_lire() lit n'importe quel type depuis PROGMEM avec la
+// bonne instruction: pgm_read_byte pour 1 octet, _word pour
+// 2, _dword pour 4. Les structs passent par memcpy_P - pour
+// un seul champ, utiliser PmStruct plus bas.
+// (pm_lire() reads any type from PROGMEM with the right
+// instruction: pgm_read_byte for 1 byte, _word for 2, _dword
+// for 4. Structs go through memcpy_P - for a single field,
+// use PmStruct below.)
+
+template <typename T>
+inline T pm_lire(const T* adresse) {
+  T valeur;
+  memcpy_P(&valeur, adresse, sizeof(T));
+  return valeur;
+}
+
+template <> inline uint8_t pm_lire(const uint8_t* a) { return pgm_read_byte(a); }
+template <> inline int8_t pm_lire(const int8_t* a) { return (int8_t)pgm_read_byte(a); }
+template <> inline char pm_lire(const char* a) { return (char)pgm_read_byte(a); }
+template <> inline bool pm_lire(const bool* a) { return pgm_read_byte(a) != 0; }
+template <> inline uint16_t pm_lire(const uint16_t* a) { return pgm_read_word(a); }
+template <> inline int16_t pm_lire(const int16_t* a) { return (int16_t)pgm_read_word(a); }
+template <> inline uint32_t pm_lire(const uint32_t* a) { return pgm_read_dword(a); }
+template <> inline int32_t pm_lire(const int32_t* a) { return (int32_t)pgm_read_dword(a); }
+
+// ==========================================================
+// TABLEAUX TYPÉS (Typed arrays)
+// ==========================================================
+// Au lieu de calculer "base = i * 3" à la main, on décrit une
+// ligne avec une struct et le compilateur calcule l'adresse.
+// Chaque lecture devient le même pgm_read_* qu'à la main:
+// rien n'est copié en RAM.
+// (Instead of computing "base = i * 3" by hand, a row is
+// described with a struct and the compiler computes the
+// address. Each read becomes the same pgm_read_* as by hand:
+// nothing is copied to RAM.)
+//
+// Usage:
+//   struct Ennemi { uint8_t x; uint8_t y; int16_t vie; };
+//   const Ennemi gn_ennemis[] PROGMEM = { {10, 20, 300}, {50, 8, 120} };
+//
+//   PmArray<Ennemi> ennemis = pm_tableau(gn_ennemis);  // taille = 2
+//   for (uint16_t i = 0; i < ennemis.taille; i++) {
+//     int x = ennemis.ligne(i).lire(&Ennemi::x);       // pgm_read_byte
+//     int vie = ennemis.ligne(i).lire(&Ennemi::vie);   // pgm_read_word
+//   }
+//
+//   PmArray<uint8_t> vitesses = pm_tableau(mh_configVitesse);
+//   int v = vitesses[niveau - 1];                      // pgm_read_byte
+//
+// Vérifier les index (Check indexes): mettre
+// #define PM_VERIFIER_LIMITES avant #include "ProgMem.h".
+// Un index trop grand lit alors le dernier élément et est
+// gardé dans pm_erreurLimite (index + 1, 0 = aucune erreur).
+// (An index too big then reads the last element and is kept
+// in pm_erreurLimite - index + 1, 0 = no error.)
+
+#ifdef PM_VERIFIER_LIMITES
+uint16_t pm_erreurLimite = 0;
+
+inline uint16_t pm_verifierIndex(uint16_t index, uint16_t taille) {
+  if (index < taille) return index;
+  if (pm_erreurLimite == 0) pm_erreurLimite = index + 1;
+  return taille - 1;
+}
+#else
+#define pm_verifierIndex(index, taille) (index)
+#endif
+
+// Une struct en PROGMEM, lue champ par champ
+// (One struct in PROGMEM, read field by field)
+template <typename T>
+struct PmStruct {
+  const T* adresse;
+
+  // Lire un champ (Read one field) - ex: p.lire(&PmPlateforme::x)
+  template <typename C>
+  C lire(C T::*champ) const { return pm_lire(&(adresse->*champ)); }
+
+  // Lire toute la struct vers la RAM (Read the whole struct to RAM)
+  T copier() const { return pm_lire(adresse); }
+};
+
+template <typename T>
+struct PmArray {
+  const T* donnees;
+  uint16_t taille;
+
+  // Élément entier (Whole element) - pour les nombres
+  T operator[](uint16_t i) const {
+    return pm_lire(&donnees[pm_verifierIndex(i, taille)]);
+  }
+
+  // Une ligne à lire champ par champ (A row to read field by field)
+  PmStruct<T> ligne(uint16_t i) const {
+    PmStruct<T> s = { &donnees[pm_verifierIndex(i, taille)] };
+    return s;
+  }
+};
+
+// Taille déduite du tableau (Size deduced from the array)
+template <typename T, size_t N>
+inline PmArray<T> pm_tableau(const T (&tableau)[N]) {
+  PmArray<T> a = { tableau, (uint16_t)N };
+  return a;
+}
+
+// Taille donnée (Given size) - pour un pointeur
+template <typename T>
+inline PmArray<T> pm_tableau(const T* tableau, uint16_t taille) {
+  PmArray<T> a = { tableau, taille };
+  return a;
+}
+
 // ==========================================================
 // FONCTIONS DE LECTURE GÉNÉRIQUES (Generic read functions)
 // ==========================================================
@@ -53,13 +183,13 @@
 // Lire un octet (0-255) depuis PROGMEM
 // (Read a byte from PROGMEM)
 inline uint8_t pm_lireByte(const uint8_t* tableau, int index) {
-  return pgm_read_byte(&tableau[index]);
+  return pm_lire(&tableau[index]);
 }
 
 // Lire un entier signé (-32768 à 32767) depuis PROGMEM
 // (Read a signed integer from PROGMEM)
 inline int16_t pm_lireInt(const int16_t* tableau, int index) {
-  return (int16_t)pgm_read_word(&tableau[index]);
+  return pm_lire(&tableau[index]);
 }
 
 // ==========================================================
@@ -68,37 +198,33 @@ inline int16_t pm_lireInt(const int16_t* tableau, int index) {
 // Pour charger des données structurées en colonnes
 // (For loading data structured in columns)
 
+// Charger un tableau [n][N] ligne par ligne
+// (Load an array [n][N] row by row)
+template <uint8_t N>
+inline void pm_chargerColonnes(const uint8_t* source, int dest[][N], int nbLignes) {
+  PmArray<uint8_t> valeurs = pm_tableau(source, nbLignes * N);
+  uint16_t k = 0;
+  for (int i = 0; i < nbLignes; i++) {
+    for (uint8_t c = 0; c < N; c++) dest[i][c] = valeurs[k++];
+  }
+}
+
 // Charger un tableau [n][2] (ex: positions x,y)
 // (Load an array [n][2] - e.g., x,y positions)
 inline void pm_charger2Colonnes(const uint8_t* source, int dest[][2], int nbLignes) {
-  for (int i = 0; i < nbLignes; i++) {
-    int base = i * 2;
-    dest[i][0] = pgm_read_byte(&source[base]);
-    dest[i][1] = pgm_read_byte(&source[base + 1]);
-  }
+  pm_chargerColonnes<2>(source, dest, nbLignes);
 }
 
 // Charger un tableau [n][3] (ex: plateformes x,y,largeur)
 // (Load an array [n][3] - e.g., platforms x,y,width)
 inline void pm_charger3Colonnes(const uint8_t* source, int dest[][3], int nbLignes) {
-  for (int i = 0; i < nbLignes; i++) {
-    int base = i * 3;
-    dest[i][0] = pgm_read_byte(&source[base]);
-    dest[i][1] = pgm_read_byte(&source[base + 1]);
-    dest[i][2] = pgm_read_byte(&source[base + 2]);
-  }
+  pm_chargerColonnes<3>(source, dest, nbLignes);
 }
 
 // Charger un tableau [n][4] (ex: objets x,y,largeur,hauteur)
 // (Load an array [n][4] - e.g., objects x,y,width,height)
 inline void pm_charger4Colonnes(const uint8_t* source, int dest[][4], int nbLignes) {
-  for (int i = 0; i < nbLignes; i++) {
-    int base = i * 4;
-    dest[i][0] = pgm_read_byte(&source[base]);
-    dest[i][1] = pgm_read_byte(&source[base + 1]);
-    dest[i][2] = pgm_read_byte(&source[base + 2]);
-    dest[i][3] = pgm_read_byte(&source[base + 3]);
-  }
+  pm_chargerColonnes<4>(source, dest, nbLignes);
 }
 
 // Alias pour compatibilité (Compatibility alias)
@@ -111,8 +237,9 @@ inline void pm_charger4Colonnes(const uint8_t* source, int dest[][4], int nbLign
 // Charger une paire de valeurs (x, y)
 // (Load a pair of values)
 inline void pm_chargerPaire(const uint8_t* source, int* a, int* b) {
-  *a = pgm_read_byte(&source[0]);
-  *b = pgm_read_byte(&source[1]);
+  PmArray<uint8_t> paire = pm_tableau(source, 2);
+  *a = paire[0];
+  *b = paire[1];
 }
 
 // Alias pour compatibilité
@@ -129,14 +256,14 @@ inline void pm_chargerPaire(const uint8_t* source, int* a, int* b) {
 // int vitesse = pm_lireConfig(mh_vitessesParNiveau, niveau - 1);
 
 inline int pm_lireConfig(const uint8_t* config, int niveau) {
-  return pgm_read_byte(&config[niveau]);
+  return pm_lire(&config[niveau]);
 }
 
 // Lire config avec valeur par défaut si niveau dépasse le tableau
 // (Read config with default value if level exceeds array)
 inline int pm_lireConfigOuDefaut(const uint8_t* config, int niveau, int taille, int defaut) {
   if (niveau >= taille) return defaut;
-  return pgm_read_byte(&config[niveau]);
+  return pm_tableau(config, taille)[niveau];
 }
 
 // ==========================================================
@@ -155,6 +282,143 @@ inline char* pm_lireTexte(const char* texteProgmem) {
   return pm_buffer;
 }
 
+// ==========================================================
+// PAQUETS COMPRESSÉS (Compressed packs)
+// ==========================================================
+// Les gros dessins et cartes prennent beaucoup de Flash. On
+// les COMPRESSE sur le PC (tools/packer/packer.py) et on les
+// décompresse octet par octet, juste quand on en a besoin.
+// (Big pictures and maps take lots of Flash. They are
+// COMPRESSED on the computer and decompressed byte by byte,
+// only when needed.)
+//
+// Format d'un paquet (Pack format):
+//   [nombre][début 0 (2 octets)]...[début n-1]  puis les données
+//   Donnée: [taille décompressée (2 octets)][jetons...]
+//
+// Jetons (Tokens):
+//   0nnnnnnn           -> n+1 octets copiés tels quels (1-128)
+//   10nnnnnn v         -> v répété n+3 fois (3-66)
+//   11nnnnnn d         -> copier n+3 octets vus d+1 octets avant (1-64)
+//   (literal run / repeat a byte / copy from the last 64 bytes)
+//
+// La fenêtre des 64 derniers octets est la seule RAM utilisée
+// (~70 octets, sur la pile pendant le chargement).
+// (The window of the last 64 bytes is the only RAM used -
+// ~70 bytes, on the stack while loading.)
+//
+// Usage - chargement de niveau (level load):
+//   #include "PackAventurier.h"     // Généré par packer.py
+//   pm_decompresser(av_pack, AV_PACK_NIVEAU1, tampon, sizeof(tampon));
+//
+// Usage - page par page (page by page):
+//   PmFlux flux;
+//   pm_fluxOuvrir(&flux, pm_packDonnee(carte_pack, CARTE_PACK_MONDE1));
+//   DESSINER_ECRAN {
+//     for (int col = 0; col < 16; col++) dessinerTuile(col, pm_fluxLire(&flux));
+//   }
+
+#define PM_FENETRE 64            // Doit suivre packer.py (Must match packer.py)
+#define PM_JETON_LITTERAL 0
+#define PM_JETON_REPETER 1
+#define PM_JETON_COPIER 2
+
+struct PmFlux {
+  const uint8_t* source;         // Prochain octet compressé (PROGMEM)
+  uint16_t restant;              // Octets encore à sortir (Bytes still to output)
+  uint8_t jeton;                 // PM_JETON_...
+  uint8_t compte;                // Octets restants du jeton (Bytes left in token)
+  uint8_t valeur;                // Octet répété ou distance (Repeated byte or distance)
+  uint8_t position;              // Écriture dans la fenêtre (Window write index)
+  uint8_t fenetre[PM_FENETRE];   // Derniers octets sortis (Last bytes output)
+};
+
+// Nombre de données dans un paquet (Number of entries in a pack)
+inline uint8_t pm_packNombre(const uint8_t* pack) {
+  return pgm_read_byte(&pack[0]);
+}
+
+// Adresse de la donnée numéro "index" (Address of entry "index")
+inline const uint8_t* pm_packDonnee(const uint8_t* pack, uint8_t index) {
+  const uint8_t* p = &pack[1 + 2 * index];
+  uint16_t debut = pgm_read_byte(&p[0]) | ((uint16_t)pgm_read_byte(&p[1]) << 8);
+  return pack + debut;
+}
+
+// Taille décompressée d'une donnée (Decompressed size of an entry)
+inline uint16_t pm_donneeTaille(const uint8_t* donnee) {
+  return pgm_read_byte(&donnee[0]) | ((uint16_t)pgm_read_byte(&donnee[1]) << 8);
+}
+
+// Commencer à lire une donnée (Start reading an entry)
+inline void pm_fluxOuvrir(PmFlux* f, const uint8_t* donnee) {
+  f->restant = pm_donneeTaille(donnee);
+  f->source = donnee + 2;
+  f->compte = 0;
+  f->position = 0;
+}
+
+// Tout est sorti? (Everything output?)
+inline bool pm_fluxFini(PmFlux* f) {
+  return f->restant == 0;
+}
+
+// Octet suivant (Next byte) - 0 après la fin (0 after the end)
+uint8_t pm_fluxLire(PmFlux* f) {
+  if (f->restant == 0) return 0;
+  
+  // Nouveau jeton? (New token?)
+  if (f->compte == 0) {
+    uint8_t c = pgm_read_byte(f->source++);
+    if (c < 0x80) {
+      f->jeton = PM_JETON_LITTERAL;
+      f->compte = c + 1;
+    } else if (c < 0xC0) {
+      f->jeton = PM_JETON_REPETER;
+      f->compte = (c & 0x3F) + 3;
+      f->valeur = pgm_read_byte(f->source++);
+    } else {
+      f->jeton = PM_JETON_COPIER;
+      f->compte = (c & 0x3F) + 3;
+      f->valeur = pgm_read_byte(f->source++) + 1;
+    }
+  }
+  
+  uint8_t octet;
+  if (f->jeton == PM_JETON_LITTERAL) {
+    octet = pgm_read_byte(f->source++);
+  } else if (f->jeton == PM_JETON_REPETER) {
+    octet = f->valeur;
+  } else {
+    octet = f->fenetre[(uint8_t)(f->position - f->valeur) & (PM_FENETRE - 1)];
+  }
+  
+  f->fenetre[f->position] = octet;
+  f->position = (f->position + 1) & (PM_FENETRE - 1);
+  f->compte--;
+  f->restant--;
+  return octet;
+}
+
+// Lire plusieurs octets (Read several bytes) - retourne le nombre lu
+// (Returns the number read)
+int pm_fluxLireBloc(PmFlux* f, uint8_t* dest, int nombre) {
+  int lus = 0;
+  while (lus < nombre && f->restant > 0) {
+    dest[lus++] = pm_fluxLire(f);
+  }
+  return lus;
+}
+
+// Décompresser une donnée entière vers la RAM (Whole entry to RAM)
+// Retourne le nombre d'octets écrits (max "taille")
+// (Returns the number of bytes written, at most "taille")
+int pm_decompresser(const uint8_t* pack, uint8_t index, uint8_t* dest, int taille) {
+  PmFlux f;
+  pm_fluxOuvrir(&f, pm_packDonnee(pack, index));
+  return pm_fluxLireBloc(&f, dest, taille);
+}
+
 // ==========================================================
 // EXEMPLES D'UTILISATION (Usage examples)
 // ==========================================================
@@ -0,0 +1,131 @@
+// ==========================================================
+// SPRITES.H - Sprites au format de l'écran (Sprites in screen format)
+// ==========================================================
+// Généré par tools/assets/assets.py depuis assets/ (make assets)
+// - ne pas modifier! (Generated from assets/ - do not edit!)
+// ==========================================================
+
+#ifndef SPRITES_H
+#define SPRITES_H
+
+#include "Display.h"
+
+// Dessiner avec dessinerSprite(x, y, &spr_nom, image) de Display.h
+// (Draw with dessinerSprite from Display.h)
+// Octets rangés [image][page][colonne], bit 0 = pixel du haut
+// (Bytes stored [frame][page][column], bit 0 = top pixel)
+
+// PORTE: porte.png
+#define SPR_PORTE_LARGEUR 8
+#define SPR_PORTE_HAUTEUR 14
+#define SPR_PORTE_PAGES 2
+#define SPR_PORTE_IMAGES 1
+#define SPR_PORTE_BOITE_X 0  // Boîte de collision (Hitbox)
+#define SPR_PORTE_BOITE_Y 0
+#define SPR_PORTE_BOITE_L 8
+#define SPR_PORTE_BOITE_H 14
+const uint8_t spr_porte_dessin[] PROGMEM = {
+  0xFF, 0x01, 0x01, 0x01, 0x81, 0x41, 0x81, 0xFF,
+  0x3F, 0x20, 0x20, 0x20, 0x20, 0x21, 0x20, 0x3F,
+};
+const uint8_t spr_porte_masque[] PROGMEM = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+};
+const Sprite spr_porte PROGMEM = { spr_porte_dessin, spr_porte_masque, 8, 14, 2, 1 };
+
+// MONSTRE: monstre.png
+#define SPR_MONSTRE_LARGEUR 9
+#define SPR_MONSTRE_HAUTEUR 9
+#define SPR_MONSTRE_PAGES 2
+#define SPR_MONSTRE_IMAGES 8
+#define SPR_MONSTRE_BOITE_X 0  // Boîte de collision (Hitbox)
+#define SPR_MONSTRE_BOITE_Y 0
+#define SPR_MONSTRE_BOITE_L 9
+#define SPR_MONSTRE_BOITE_H 9
+const uint8_t spr_monstre_dessin[] PROGMEM = {
+  0xFF, 0xFE, 0xFE, 0x7C, 0x7C, 0x38, 0x38, 0x10, 0x10,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFE, 0xEE, 0x7C, 0x7C, 0x38, 0x38, 0x10, 0x10,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x10, 0x38, 0x38, 0x7C, 0x7C, 0xFE, 0xFE, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x10, 0x10, 0x38, 0x38, 0x7C, 0x7C, 0xEE, 0xFE, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x07, 0x1F, 0x7F, 0xFF, 0x7F, 0x1F, 0x07, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x07, 0x1F, 0x7F, 0xFB, 0x7F, 0x1F, 0x07, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xC0, 0xF0, 0xFC, 0xFF, 0xFC, 0xF0, 0xC0, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x00, 0xC0, 0xF0, 0xFC, 0xBF, 0xFC, 0xF0, 0xC0, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+};
+const uint8_t spr_monstre_masque[] PROGMEM = {
+  0xFF, 0xFE, 0xFE, 0x7C, 0x7C, 0x38, 0x38, 0x10, 0x10,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0xFE, 0xFE, 0x7C, 0x7C, 0x38, 0x38, 0x10, 0x10,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x10, 0x38, 0x38, 0x7C, 0x7C, 0xFE, 0xFE, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x10, 0x10, 0x38, 0x38, 0x7C, 0x7C, 0xFE, 0xFE, 0xFF,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x07, 0x1F, 0x7F, 0xFF, 0x7F, 0x1F, 0x07, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x07, 0x1F, 0x7F, 0xFF, 0x7F, 0x1F, 0x07, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xC0, 0xF0, 0xFC, 0xFF, 0xFC, 0xF0, 0xC0, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x00, 0xC0, 0xF0, 0xFC, 0xFF, 0xFC, 0xF0, 0xC0, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+};
+const Sprite spr_monstre PROGMEM = { spr_monstre_dessin, spr_monstre_masque, 9, 9, 2, 8 };
+
+// BOSS: boss.png
+#define SPR_BOSS_LARGEUR 15
+#define SPR_BOSS_HAUTEUR 15
+#define SPR_BOSS_PAGES 2
+#define SPR_BOSS_IMAGES 8
+#define SPR_BOSS_BOITE_X 0  // Boîte de collision (Hitbox)
+#define SPR_BOSS_BOITE_Y 0
+#define SPR_BOSS_BOITE_L 15
+#define SPR_BOSS_BOITE_H 15
+const uint8_t spr_boss_dessin[] PROGMEM = {
+  0xFF, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80,
+  0x7F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00,
+  0xFF, 0xFE, 0xFE, 0xFC, 0x7C, 0x78, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80,
+  0x7F, 0x3F, 0x3F, 0x1F, 0x1E, 0x0E, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00,
+  0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFF,
+  0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0x7F,
+  0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0x7C, 0x7C, 0xFE, 0xFE, 0xFF,
+  0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x1E, 0x1E, 0x3F, 0x3F, 0x7F,
+  0x01, 0x07, 0x1F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x1F, 0x07, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x1F, 0x7F, 0x1F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x07, 0x1F, 0x7F, 0xFF, 0xFF, 0xFF, 0xCF, 0xCF, 0xFF, 0xFF, 0x7F, 0x1F, 0x07, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x1F, 0x7F, 0x1F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0xFC, 0xFF, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0x40, 0x70, 0x7C, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7C, 0x70, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0xFC, 0xFF, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0x40, 0x70, 0x7C, 0x7F, 0x7F, 0x7F, 0x7F, 0x73, 0x73, 0x7F, 0x7F, 0x7F, 0x7C, 0x70, 0x40,
+};
+const uint8_t spr_boss_masque[] PROGMEM = {
+  0xFF, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80,
+  0x7F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00,
+  0xFF, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80,
+  0x7F, 0x3F, 0x3F, 0x1F, 0x1F, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00,
+  0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFF,
+  0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0x7F,
+  0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xF0, 0xF0, 0xF8, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFF,
+  0x00, 0x00, 0x01, 0x01, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x1F, 0x1F, 0x3F, 0x3F, 0x7F,
+  0x01, 0x07, 0x1F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x1F, 0x07, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x1F, 0x7F, 0x1F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x07, 0x1F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x1F, 0x07, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x1F, 0x7F, 0x1F, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0xFC, 0xFF, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0x40, 0x70, 0x7C, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7C, 0x70, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0xC0, 0xF0, 0xFC, 0xFF, 0xFC, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00,
+  0x40, 0x70, 0x7C, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7C, 0x70, 0x40,
+};
+const Sprite spr_boss PROGMEM = { spr_boss_dessin, spr_boss_masque, 15, 15, 2, 8 };
+
+#endif
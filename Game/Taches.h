@@ -0,0 +1,170 @@
+// ==========================================================
+// TACHES.H - Tâches qui attendent sans bloquer
+// (Tasks that wait without blocking)
+// ==========================================================
+// Une mélodie ou un écran "BRAVO!" faisait delay(): pendant
+// ce temps, plus rien ne tournait. Une tâche est une fonction
+// qui S'ARRÊTE au lieu d'attendre, et REPREND au même endroit
+// au passage suivant de loop() (protothread, sans pile).
+// (A melody or a "BRAVO!" screen used delay(): meanwhile
+// nothing else ran. A task is a function that STOPS instead of
+// waiting, and RESUMES at the same place on the next pass of
+// loop() - a stackless protothread.)
+//
+//   bool maTache(Tache* t) {
+//     TACHE_DEBUT(t);
+//     tone(BUZZER_PIN, 523, 100);
+//     TACHE_ATTENDRE(t, 150);      // loop() continue! (loop() goes on!)
+//     tone(BUZZER_PIN, 659, 100);
+//     TACHE_FIN(t);
+//   }
+//   tache_lancer(maTache);
+//
+// ATTENTION: les variables locales sont perdues à chaque
+// attente. Garder l'état dans des variables globales.
+// (WARNING: local variables are lost at every wait. Keep the
+// state in global variables.)
+//
+// RAM: 8 octets par case, TACHES_MAX cases (8 bytes per slot)
+// ==========================================================
+
+#ifndef TACHES_H
+#define TACHES_H
+
+#include <Arduino.h>
+#ifdef __AVR__
+#include <avr/sleep.h>
+#endif
+
+// Une case par FONCTION de tâche (relancer reprend sa case).
+// Le croquis en a 2: mel_jouer et attente_tache. Il en reste 2.
+// (One slot per task FUNCTION - restarting reuses its slot. The
+// sketch has 2: mel_jouer and attente_tache. 2 are left.)
+#define TACHES_MAX 4
+
+// Où reprendre, et quand (Where to resume, and when)
+struct Tache {
+  uint16_t ligne;        // 0 = depuis le début (0 = from the start)
+  unsigned long reveil;  // millis() du prochain passage (Next run)
+};
+
+// Retourne true tant que la tâche n'est pas finie
+// (Returns true until the task is done)
+typedef bool (*FonctionTache)(Tache* t);
+
+// ----------------------------------------------------------
+// Macros des tâches (Task macros)
+// ----------------------------------------------------------
+// Chaque attente est un "case" du switch de TACHE_DEBUT,
+// numéroté par sa ligne: une seule attente par ligne!
+// (Each wait is a "case" of TACHE_DEBUT's switch, numbered by
+// its line: only one wait per line!)
+
+#define TACHE_DEBUT(t) switch ((t)->ligne) { case 0:
+
+#define TACHE_FIN(t) } (t)->ligne = 0; return false
+
+// Attendre "ms" millisecondes (Wait "ms" milliseconds)
+#define TACHE_ATTENDRE(t, ms) \
+  do { (t)->reveil = millis() + (ms); (t)->ligne = __LINE__; return true; case __LINE__:; } while (0)
+
+// Attendre jusqu'à un moment de millis() (Wait until a millis() time)
+#define TACHE_ATTENDRE_JUSQUA(t, moment) \
+  do { (t)->reveil = (moment); (t)->ligne = __LINE__; return true; case __LINE__:; } while (0)
+
+// Laisser passer les autres, reprendre au plus vite
+// (Let the others run, resume as soon as possible)
+#define TACHE_CEDER(t) TACHE_ATTENDRE(t, 0)
+
+// Revenir chaque milliseconde tant que la condition est fausse
+// (Come back every millisecond while the condition is false)
+#define TACHE_ATTENDRE_QUE(t, condition) \
+  do { \
+    (t)->ligne = __LINE__; \
+    if (false) { case __LINE__:; } \
+    if (!(condition)) { (t)->reveil = millis() + 1; return true; } \
+  } while (0)
+
+// ==========================================================
+// ORDONNANCEUR (Scheduler)
+// ==========================================================
+
+FonctionTache taches_fonctions[TACHES_MAX];
+Tache taches_etats[TACHES_MAX];
+
+inline bool tache_estPrete(const Tache* t) {
+  return (long)(millis() - t->reveil) >= 0;
+}
+
+// Case d'une tâche, -1 si elle ne tourne pas
+// (Slot of a task, -1 if it is not running)
+int tache_trouver(FonctionTache f) {
+  for (int i = 0; i < TACHES_MAX; i++) {
+    if (taches_fonctions[i] == f) return i;
+  }
+  return -1;
+}
+
+bool tache_active(FonctionTache f) {
+  return tache_trouver(f) >= 0;
+}
+
+// Lancer une tâche depuis le début. Si elle tourne déjà, elle
+// REPART du début. Retourne false si tout est plein: la tâche
+// n'est pas lancée, à l'appelant de faire sans (jamais
+// d'attente bloquante ici).
+// (Start a task from the beginning. If it is already running,
+// it STARTS OVER. Returns false if every slot is taken: the
+// task is not started and the caller does without - never a
+// blocking wait here.)
+bool tache_lancer(FonctionTache f) {
+  int i = tache_trouver(f);
+  if (i < 0) i = tache_trouver(nullptr);
+  if (i < 0) return false;
+  taches_fonctions[i] = f;
+  taches_etats[i].ligne = 0;
+  taches_etats[i].reveil = millis();
+  return true;
+}
+
+void tache_arreter(FonctionTache f) {
+  int i = tache_trouver(f);
+  if (i >= 0) taches_fonctions[i] = nullptr;
+}
+
+// Un passage: chaque tâche prête avance jusqu'à sa prochaine
+// attente; une tâche finie libère sa case.
+// (One pass: each ready task runs to its next wait; a finished
+// task frees its slot.)
+void taches_avancer() {
+  for (int i = 0; i < TACHES_MAX; i++) {
+    FonctionTache f = taches_fonctions[i];
+    if (f && tache_estPrete(&taches_etats[i])) {
+      if (!f(&taches_etats[i]) && taches_fonctions[i] == f) {
+        taches_fonctions[i] = nullptr;
+      }
+    }
+  }
+}
+
+// Une tâche veut tourner maintenant? (Does a task want to run now?)
+bool taches_pretes() {
+  for (int i = 0; i < TACHES_MAX; i++) {
+    if (taches_fonctions[i] && tache_estPrete(&taches_etats[i])) return true;
+  }
+  return false;
+}
+
+// Dormir jusqu'à la prochaine interruption (au plus ~1 ms, celle
+// de millis()), sauf si une tâche est prête.
+// (Sleep until the next interrupt - at most ~1 ms, the millis()
+// one - unless a task is ready.)
+void taches_dormir() {
+  if (taches_pretes()) return;
+#ifdef __AVR__
+  set_sleep_mode(SLEEP_MODE_IDLE);
+  sleep_mode();
+#endif
+}
+
+#endif
@@ -0,0 +1,379 @@
+#!/usr/bin/env python3
+# ==========================================================
+# ASSETS.PY - Images et niveaux vers PROGMEM
+# (Pictures and levels to PROGMEM)
+# ==========================================================
+# Transforme les fichiers de assets/ en fichiers .h prêts à
+# compiler, pour ne plus taper les octets à la main.
+# (Turns the files in assets/ into ready-to-compile .h
+# files, so bytes are no longer typed by hand.)
+#
+# sprites: planches PNG 1 bit -> octets au format de l'écran
+#   SSD1306: 1 octet = 8 pixels VERTICAUX, bit 0 en haut,
+#   rangés [image][page][colonne]. Une page d'image = une
+#   page d'écran: le dessin copie les octets sans les
+#   retourner. (1 byte = 8 VERTICAL pixels, bit 0 on top,
+#   stored [frame][page][column]: one sprite page = one
+#   screen page, so drawing copies bytes without reshuffling.)
+#
+#   Pixel clair = allumé, pixel sombre = éteint. Si le PNG a
+#   un canal alpha, un masque est aussi généré: pixel
+#   opaque = le sprite remplace le fond (même s'il est noir).
+#   (Light pixel = on, dark pixel = off. If the PNG has an
+#   alpha channel, a mask is generated too: opaque pixel =
+#   the sprite replaces the background, even when black.)
+#
+# niveaux: cartes ASCII -> tableaux PLATEFORMES_PROGMEM
+#   Une case = 4 pixels de large, 2 de haut (32 x 32 cases).
+#   '0'-'9': plateforme numéro n (le haut de la case = y)
+#   'P': porte, '.' ou ' ': vide
+#   (One cell = 4 pixels wide, 2 tall. '0'-'9': platform n,
+#   'P': door, '.' or ' ': empty)
+#
+# Usage:
+#   python3 tools/assets/assets.py sprites -o Game/Sprites.h \
+#       PORTE=assets/sprites/porte.png JOUEUR=assets/sprites/joueur.png:8
+#   python3 tools/assets/assets.py niveaux -o Game/NiveauxAventurier.h \
+#       -p av_niv assets/niveaux/aventurier1.txt ...
+#
+# ":8" = largeur d'une image dans la planche (frame width in
+# the sheet). Sans elle: une seule image (one frame).
+# ==========================================================
+
+import argparse
+import os
+import re
+import struct
+import sys
+import zlib
+
+
+# ==========================================================
+# LECTURE PNG (PNG reading) - sans bibliothèque (no library)
+# ==========================================================
+
+def lire_png(chemin):
+    """Retourne (largeur, hauteur, pixels, alpha?) avec pixels[y][x] = (gris, alpha)."""
+    with open(chemin, "rb") as f:
+        donnees = f.read()
+    if donnees[:8] != b"\x89PNG\r\n\x1a\n":
+        sys.exit("%s: pas un PNG (not a PNG)" % chemin)
+
+    pos = 8
+    idat = b""
+    palette = []
+    transparence = b""
+    while pos < len(donnees):
+        taille, genre = struct.unpack(">I4s", donnees[pos:pos + 8])
+        bloc = donnees[pos + 8:pos + 8 + taille]
+        pos += 12 + taille
+        if genre == b"IHDR":
+            largeur, hauteur, profondeur, couleur, _, _, entrelace = struct.unpack(">IIBBBBB", bloc)
+        elif genre == b"PLTE":
+            palette = [tuple(bloc[i:i + 3]) for i in range(0, len(bloc), 3)]
+        elif genre == b"tRNS":
+            transparence = bloc
+        elif genre == b"IDAT":
+            idat += bloc
+        elif genre == b"IEND":
+            break
+
+    if entrelace:
+        sys.exit("%s: PNG entrelacé non supporté (interlaced PNG)" % chemin)
+    canaux = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[couleur]
+    bits = canaux * profondeur
+    octetsPixel = max(1, bits // 8)
+    octetsLigne = (largeur * bits + 7) // 8
+    brut = zlib.decompress(idat)
+
+    # Défiltrer (Unfilter)
+    lignes = []
+    precedente = bytearray(octetsLigne)
+    i = 0
+    for _ in range(hauteur):
+        filtre = brut[i]
+        ligne = bytearray(brut[i + 1:i + 1 + octetsLigne])
+        i += 1 + octetsLigne
+        for k in range(octetsLigne):
+            a = ligne[k - octetsPixel] if k >= octetsPixel else 0
+            b = precedente[k]
+            c = precedente[k - octetsPixel] if k >= octetsPixel else 0
+            if filtre == 1:
+                ligne[k] = (ligne[k] + a) & 0xFF
+            elif filtre == 2:
+                ligne[k] = (ligne[k] + b) & 0xFF
+            elif filtre == 3:
+                ligne[k] = (ligne[k] + (a + b) // 2) & 0xFF
+            elif filtre == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                ligne[k] = (ligne[k] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xFF
+        lignes.append(ligne)
+        precedente = ligne
+
+    # Échantillons -> (gris 0-255, alpha 0-255) (Samples -> gray, alpha)
+    maximum = (1 << profondeur) - 1
+    pixels = []
+    for ligne in lignes:
+        if profondeur >= 8:
+            pas = profondeur // 8
+            valeurs = [ligne[k] for k in range(0, len(ligne), pas)]  # 16 bits: octet fort
+        else:
+            valeurs = []
+            for octet in ligne:
+                for decalage in range(8 - profondeur, -1, -profondeur):
+                    valeurs.append((octet >> decalage) & maximum)
+        rangee = []
+        for x in range(largeur):
+            v = valeurs[x * canaux:(x + 1) * canaux]
+            if couleur == 3:
+                r, g, b = palette[v[0]]
+                alpha = transparence[v[0]] if v[0] < len(transparence) else 255
+                rangee.append(((r + g + b) // 3, alpha))
+                continue
+            echelle = 255 // maximum if profondeur < 8 else 1
+            if couleur == 0:
+                alpha = 0 if transparence and v[0] == struct.unpack(">H", transparence)[0] else 255
+                rangee.append((v[0] * echelle, alpha))
+            elif couleur == 2:
+                rangee.append(((v[0] + v[1] + v[2]) // 3, 255))
+            elif couleur == 4:
+                rangee.append((v[0], v[1]))
+            else:
+                rangee.append(((v[0] + v[1] + v[2]) // 3, v[3]))
+        pixels.append(rangee)
+    return largeur, hauteur, pixels, couleur in (4, 6) or len(transparence) > 0
+
+
+# ==========================================================
+# SPRITES
+# ==========================================================
+
+def convertir_sprite(nom, chemin, largeurImage):
+    largeur, hauteur, pixels, avecMasque = lire_png(chemin)
+    if largeurImage is None:
+        largeurImage = largeur
+    if largeur % largeurImage:
+        sys.exit("%s: largeur %d pas divisible par %d" % (chemin, largeur, largeurImage))
+    if largeurImage > 128 or hauteur > 64:
+        sys.exit("%s: plus grand que l'écran (bigger than the screen)" % chemin)
+
+    images = largeur // largeurImage
+    pages = (hauteur + 7) // 8
+
+    def allume(x, y):
+        return y < hauteur and pixels[y][x][1] >= 128 and pixels[y][x][0] >= 128
+
+    def opaque(x, y):
+        return y < hauteur and pixels[y][x][1] >= 128
+
+    dessin = []
+    masque = []
+    for image in range(images):
+        for page in range(pages):
+            for colonne in range(largeurImage):
+                x = image * largeurImage + colonne
+                octet = 0
+                bord = 0
+                for bit in range(8):
+                    y = page * 8 + bit
+                    if allume(x, y):
+                        octet |= 1 << bit
+                    if opaque(x, y):
+                        bord |= 1 << bit
+                dessin.append(octet)
+                masque.append(bord)
+
+    # Boîte de collision: pixels visibles de toutes les images
+    # (Hitbox: visible pixels of every frame)
+    visible = allume if not avecMasque else opaque
+    xs = [x % largeurImage for y in range(hauteur) for x in range(largeur) if visible(x, y)]
+    ys = [y for y in range(hauteur) for x in range(largeur) if visible(x, y)]
+    if xs:
+        boite = (min(xs), min(ys), max(xs) - min(xs) + 1, max(ys) - min(ys) + 1)
+    else:
+        boite = (0, 0, 0, 0)
+
+    return {
+        "nom": nom, "chemin": chemin, "largeur": largeurImage, "hauteur": hauteur,
+        "pages": pages, "images": images, "boite": boite,
+        "dessin": dessin, "masque": masque if avecMasque else None,
+    }
+
+
+def ecrire_tableau(lignes, nom, octets, largeurLigne):
+    lignes.append("const uint8_t %s[] PROGMEM = {" % nom)
+    for i in range(0, len(octets), largeurLigne):
+        lignes.append("  " + ", ".join("0x%02X" % b for b in octets[i:i + largeurLigne]) + ",")
+    lignes.append("};")
+
+
+def ecrire_sprites(chemin, sprites):
+    lignes = entete(chemin, "Sprites au format de l'écran (Sprites in screen format)", "Display.h")
+    lignes += [
+        "// Dessiner avec dessinerSprite(x, y, &spr_nom, image) de Display.h",
+        "// (Draw with dessinerSprite from Display.h)",
+        "// Octets rangés [image][page][colonne], bit 0 = pixel du haut",
+        "// (Bytes stored [frame][page][column], bit 0 = top pixel)",
+        "",
+    ]
+    for s in sprites:
+        N = "SPR_" + s["nom"].upper()
+        n = "spr_" + s["nom"].lower()
+        bx, by, bl, bh = s["boite"]
+        lignes += [
+            "// %s: %s" % (s["nom"].upper(), os.path.basename(s["chemin"])),
+            "#define %s_LARGEUR %d" % (N, s["largeur"]),
+            "#define %s_HAUTEUR %d" % (N, s["hauteur"]),
+            "#define %s_PAGES %d" % (N, s["pages"]),
+            "#define %s_IMAGES %d" % (N, s["images"]),
+            "#define %s_BOITE_X %d  // Boîte de collision (Hitbox)" % (N, bx),
+            "#define %s_BOITE_Y %d" % (N, by),
+            "#define %s_BOITE_L %d" % (N, bl),
+            "#define %s_BOITE_H %d" % (N, bh),
+        ]
+        ecrire_tableau(lignes, n + "_dessin", s["dessin"], s["largeur"])
+        masque = "nullptr"
+        if s["masque"] is not None:
+            ecrire_tableau(lignes, n + "_masque", s["masque"], s["largeur"])
+            masque = n + "_masque"
+        lignes.append("const Sprite %s PROGMEM = { %s_dessin, %s, %d, %d, %d, %d };"
+                      % (n, n, masque, s["largeur"], s["hauteur"], s["pages"], s["images"]))
+        lignes.append("")
+    fin(chemin, lignes)
+
+
+# ==========================================================
+# NIVEAUX (Levels)
+# ==========================================================
+
+CASE_LARGEUR = 4
+CASE_HAUTEUR = 2
+CARTE_COLONNES = 128 // CASE_LARGEUR
+CARTE_LIGNES = 64 // CASE_HAUTEUR
+
+
+def convertir_niveau(chemin):
+    with open(chemin, encoding="utf-8") as f:
+        texte = f.read()
+    rangees = [l.rstrip("\n") for l in texte.split("\n") if not l.startswith("//")]
+    while rangees and rangees[-1] == "":
+        rangees.pop()
+    if len(rangees) != CARTE_LIGNES:
+        sys.exit("%s: %d lignes, %d attendues (rows expected)" % (chemin, len(rangees), CARTE_LIGNES))
+
+    plateformes = {}
+    porte = None
+    for ligne, rangee in enumerate(rangees):
+        if len(rangee) > CARTE_COLONNES:
+            sys.exit("%s:%d: plus de %d colonnes" % (chemin, ligne + 1, CARTE_COLONNES))
+        for colonne, c in enumerate(rangee):
+            if c in ". ":
+                continue
+            x, y = colonne * CASE_LARGEUR, ligne * CASE_HAUTEUR
+            if c == "P":
+                if porte:
+                    sys.exit("%s:%d: deux portes (two doors)" % (chemin, ligne + 1))
+                porte = (x, y)
+            elif c.isdigit():
+                n = int(c)
+                if n in plateformes:
+                    px, py, pl = plateformes[n]
+                    if py != y or px + pl != x:
+                        sys.exit("%s:%d: plateforme %d coupée (platform %d split)" % (chemin, ligne + 1, n, n))
+                    plateformes[n] = (px, py, pl + CASE_LARGEUR)
+                else:
+                    plateformes[n] = (x, y, CASE_LARGEUR)
+            else:
+                sys.exit("%s:%d: caractère '%s' inconnu (unknown char)" % (chemin, ligne + 1, c))
+
+    if porte is None:
+        sys.exit("%s: pas de porte (no door)" % chemin)
+    if sorted(plateformes) != list(range(len(plateformes))):
+        sys.exit("%s: plateformes à numéroter 0, 1, 2... (number platforms 0, 1, 2...)" % chemin)
+    return [plateformes[n] for n in range(len(plateformes))], porte
+
+
+def ecrire_niveaux(chemin, prefixe, fichiers):
+    lignes = entete(chemin, "Niveaux (Levels)")
+    lignes += [
+        "// Plateformes {x, y, largeur} et porte {x, y} de chaque carte",
+        "// (Platforms and door of each map)",
+        "",
+    ]
+    noms = []
+    for numero, fichier in enumerate(fichiers, 1):
+        plateformes, porte = convertir_niveau(fichier)
+        nom = "%s%d" % (prefixe, numero)
+        noms.append((nom, len(plateformes)))
+        lignes.append("// %s (%d plateformes)" % (os.path.basename(fichier), len(plateformes)))
+        lignes.append("PLATEFORMES_PROGMEM(%s_plat, {" % nom)
+        for i, (x, y, l) in enumerate(plateformes):
+            lignes.append("  { %d, %d, %d }%s" % (x, y, l, "," if i < len(plateformes) - 1 else ""))
+        lignes.append("});")
+        lignes.append("const uint8_t %s_porte[] PROGMEM = { %d, %d };" % (nom, porte[0], porte[1]))
+        lignes.append("")
+    lignes.append("#define %s_NB_NIVEAUX %d" % (prefixe.upper().rstrip("_"), len(fichiers)))
+    lignes.append("")
+    fin(chemin, lignes)
+
+
+# ==========================================================
+# FICHIER .H (.h file)
+# ==========================================================
+
+def entete(chemin, titre, inclure="ProgMem.h"):
+    garde = re.sub(r"\W", "_", os.path.basename(chemin)).upper()
+    return [
+        "// ==========================================================",
+        "// %s - %s" % (os.path.basename(chemin).upper(), titre),
+        "// ==========================================================",
+        "// Généré par tools/assets/assets.py depuis assets/ (make assets)",
+        "// - ne pas modifier! (Generated from assets/ - do not edit!)",
+        "// ==========================================================",
+        "",
+        "#ifndef %s" % garde,
+        "#define %s" % garde,
+        "",
+        '#include "%s"' % inclure,
+        "",
+    ]
+
+
+def fin(chemin, lignes):
+    lignes.append("#endif")
+    with open(chemin, "w", encoding="utf-8") as f:
+        f.write("\n".join(lignes) + "\n")
+    print("%s: ok" % chemin)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Images et niveaux vers PROGMEM")
+    sous = parser.add_subparsers(dest="commande")
+    sous.required = True
+
+    p = sous.add_parser("sprites", help="Planches PNG 1 bit (1-bit PNG sheets)")
+    p.add_argument("-o", "--sortie", required=True)
+    p.add_argument("fichiers", nargs="+", help="NOM=fichier.png[:largeurImage]")
+
+    p = sous.add_parser("niveaux", help="Cartes ASCII (ASCII maps)")
+    p.add_argument("-o", "--sortie", required=True)
+    p.add_argument("-p", "--prefixe", required=True, help="ex: av_niv")
+    p.add_argument("fichiers", nargs="+")
+
+    args = parser.parse_args()
+    if args.commande == "sprites":
+        sprites = []
+        for argument in args.fichiers:
+            m = re.match(r"^(\w+)=(.+?)(?::(\d+))?$", argument)
+            if not m:
+                sys.exit("%s: attendu NOM=fichier.png[:largeur]" % argument)
+            largeurImage = int(m.group(3)) if m.group(3) else None
+            sprites.append(convertir_sprite(m.group(1), m.group(2), largeurImage))
+        ecrire_sprites(args.sortie, sprites)
+    else:
+        ecrire_niveaux(args.sortie, args.prefixe, args.fichiers)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,174 @@
+// ==========================================================
+// BENCH.H - Petit outil de mesure de vitesse
+// (Tiny speed measurement harness)
+// ==========================================================
+// Deux modes avec le MÊME code de test:
+// (Two modes with the SAME test code:)
+//
+// - PC (host):   nanosecondes par appel + appels/seconde
+//                (nanoseconds per call + calls/second)
+// - AVR (simavr): cycles par appel, mesurés avec Timer1
+//                (cycles per call, measured with Timer1)
+//
+// La ligne "(boucle)" donne le coût de la boucle de test
+// elle-même - à soustraire des autres lignes sur AVR.
+// (The "(boucle)" row is the cost of the test loop itself -
+// subtract it from the other rows on AVR.)
+// ==========================================================
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdint.h>
+
+// Résultat "utilisé" pour que le compilateur garde les calculs
+// (Sink so the compiler keeps the work)
+volatile int32_t bench_puits = 0;
+
+#ifdef __AVR__
+
+// ==========================================================
+// MODE AVR - Timer1 compte chaque cycle (prescaler 1)
+// (AVR mode - Timer1 counts every cycle)
+// ==========================================================
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#include <stdlib.h>
+#include <string.h>
+#include <avr/avr_mcu_section.h>  // simavr: console + config MCU
+
+// Dit à simavr: ATmega328P à 16 MHz, et écrire dans GPIOR0 = afficher
+// (Tells simavr: ATmega328P at 16 MHz, and writing GPIOR0 = print)
+AVR_MCU(F_CPU, "atmega328p");
+AVR_MCU_SIMAVR_CONSOLE(&GPIOR0);
+
+volatile uint16_t bench_debordements = 0;
+
+ISR(TIMER1_OVF_vect) {
+  bench_debordements++;
+}
+
+void bench_demarrer() {
+  TCCR1A = 0;
+  TCCR1B = _BV(CS10);   // Horloge CPU sans division (No prescaler)
+  TIMSK1 = _BV(TOIE1);  // Interruption à chaque tour (Overflow IRQ)
+  sei();
+}
+
+// Lire le compteur de cycles 32 bits (Read 32-bit cycle counter)
+uint32_t bench_lireCycles() {
+  uint8_t sreg = SREG;
+  cli();
+  uint16_t t = TCNT1;
+  uint16_t d = bench_debordements;
+  // Débordement arrivé pendant cli()? (Overflow pending during cli()?)
+  if ((TIFR1 & _BV(TOV1)) && t < 0x8000) d++;
+  SREG = sreg;
+  return ((uint32_t)d << 16) | t;
+}
+
+void bench_ecrire(const char* texte) {
+  while (*texte) GPIOR0 = *texte++;
+}
+
+void bench_ecrireNombre(long nombre, int8_t largeur) {
+  char tampon[12];
+  ltoa(nombre, tampon, 10);
+  for (int8_t n = largeur - (int8_t)strlen(tampon); n > 0; n--) GPIOR0 = ' ';
+  bench_ecrire(tampon);
+}
+
+void bench_entete(const char* titre) {
+  bench_ecrire("\n== ");
+  bench_ecrire(titre);
+  bench_ecrire(" ==\nnoyau                      taille  cycles/appel\n");
+}
+
+// Mesurer f(0) ... f(n-1) (Measure f(0) ... f(n-1))
+template <typename F>
+void bench_mesurer(const char* nom, int taille, long n, F f) {
+  uint32_t debut = bench_lireCycles();
+  for (long i = 0; i < n; i++) f((int)i);
+  uint32_t duree = bench_lireCycles() - debut;
+
+  bench_ecrire(nom);
+  for (int8_t k = 26 - (int8_t)strlen(nom); k > 0; k--) GPIOR0 = ' ';
+  if (taille > 0) bench_ecrireNombre(taille, 7);
+  else bench_ecrire("      -");
+  bench_ecrireNombre((long)(duree / n), 14);
+  bench_ecrire("\n");
+}
+
+// Taille en Flash: brut -> compressé (Flash size: raw -> compressed)
+void bench_flash(const char* nom, int brut, int compresse) {
+  bench_ecrire(nom);
+  for (int8_t k = 26 - (int8_t)strlen(nom); k > 0; k--) GPIOR0 = ' ';
+  bench_ecrireNombre(brut, 7);
+  bench_ecrire(" -> ");
+  bench_ecrireNombre(compresse, 5);
+  bench_ecrire(" octets, ");
+  bench_ecrireNombre(brut - compresse, 5);
+  bench_ecrire(" gagnes\n");
+}
+
+// Fin de simulation: dormir sans interruptions arrête simavr
+// (End of simulation: sleeping with interrupts off stops simavr)
+void bench_terminer() {
+  cli();
+  sleep_cpu();
+}
+
+#else
+
+// ==========================================================
+// MODE PC - horloge std::chrono (Host mode - std::chrono)
+// ==========================================================
+
+#include <chrono>
+#include <stdio.h>
+
+// Durée minimum d'une mesure (Minimum measuring time)
+#define BENCH_DUREE_MIN_NS 20000000LL
+
+void bench_demarrer() { }
+
+void bench_entete(const char* titre) {
+  printf("\n== %s ==\n", titre);
+  printf("%-26s %6s %12s %12s\n", "noyau", "taille", "ns/appel", "Mappels/s");
+}
+
+// Mesurer f(i) en doublant n jusqu'à au moins 20 ms
+// (Measure f(i), doubling n until at least 20 ms)
+template <typename F>
+void bench_mesurer(const char* nom, int taille, long n, F f) {
+  long long duree = 0;
+  for (;;) {
+    auto debut = std::chrono::steady_clock::now();
+    for (long i = 0; i < n; i++) f((int)i);
+    auto fin = std::chrono::steady_clock::now();
+    duree = std::chrono::duration_cast<std::chrono::nanoseconds>(fin - debut).count();
+    if (duree >= BENCH_DUREE_MIN_NS) break;
+    n = n * 2;
+  }
+
+  double nsParAppel = (double)duree / (double)n;
+  if (taille > 0) {
+    printf("%-26s %6d %12.2f %12.2f\n", nom, taille, nsParAppel, 1000.0 / nsParAppel);
+  } else {
+    printf("%-26s %6s %12.2f %12.2f\n", nom, "-", nsParAppel, 1000.0 / nsParAppel);
+  }
+}
+
+// Taille en Flash: brut -> compressé (Flash size: raw -> compressed)
+void bench_flash(const char* nom, int brut, int compresse) {
+  printf("%-26s %6d -> %5d octets, %5d gagnes (%d%%)\n", nom, brut, compresse,
+         brut - compresse, 100 * compresse / brut);
+}
+
+void bench_terminer() { }
+
+#endif
+
+#endif
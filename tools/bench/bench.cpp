@@ -0,0 +1,665 @@
+// ==========================================================
+// BENCH.CPP - Mesure de vitesse du moteur de jeu
+// (Game engine speed measurements)
+// ==========================================================
+// Mesure les fonctions les plus appelées de Physics.h,
+// Objects.h et Procedural.h avec des pools de 6 à 256,
+// la décompression des paquets de ProgMem.h et les sprites
+// de Display.h.
+// (Measures the hottest helpers of Physics.h, Objects.h
+// and Procedural.h with pools from 6 to 256, the pack
+// decompression of ProgMem.h and the sprites of Display.h.)
+//
+//   make bench       -> sur PC (ns/appel)
+//   make bench-avr   -> sur ATmega328P simulé (cycles/appel)
+//
+// Sur AVR, la RAM (2 KB) limite les pools à 64 objets.
+// (On AVR, the 2 KB of RAM limits pools to 64 objects.)
+// ==========================================================
+
+#include "Bench.h"
+
+// Arduino inclut ceci automatiquement (Arduino includes this automatically)
+#include <Arduino.h>
+#include <avr/pgmspace.h>
+
+#include "Physics.h"
+#include "Procedural.h"
+#include "Objects.h"
+#include "Entites.h"
+#include "Minuteries.h"
+#include "Taches.h"
+#include "GameBase.h"
+#include "ProgMem.h"
+#include "Display.h"
+#include "Sprites.h"
+#include "Personnages.h"
+
+// Généré par packer.py depuis tools/bench/donnees (make bench)
+// (Generated by packer.py from tools/bench/donnees)
+#include "BenchPack.h"
+
+// ==========================================================
+// CONFIGURATION (Configuration)
+// ==========================================================
+
+#ifdef __AVR__
+static const int bench_taillesPool[] = { 6, 16, 64 };
+#define BENCH_NB_TAILLES 3
+#define BENCH_POOL_MAX 64
+#define BENCH_N_RAPIDE 1000L    // Appels pour les petites fonctions
+#define BENCH_N_LENT 20L        // Appels pour les grosses fonctions
+#define BENCH_TAMPON_PAQUET 256 // Sortie de pm_decompresser (Output buffer)
+#else
+static const int bench_taillesPool[] = { 6, 16, 64, 256 };
+#define BENCH_NB_TAILLES 4
+#define BENCH_POOL_MAX 256
+#define BENCH_N_RAPIDE 100000L
+#define BENCH_N_LENT 1000L
+#define BENCH_TAMPON_PAQUET 512
+#endif
+
+// Coordonnées de test (Test coordinates) - 64 points
+#define BENCH_NB_POINTS 64
+int bench_px[BENCH_NB_POINTS];
+int bench_py[BENCH_NB_POINTS];
+
+// 16 plateformes en Flash, comme bench_pool1 (16 platforms in Flash)
+PLATEFORMES_PROGMEM(bench_platFlash, {
+  { 3, 40, 25 }, { 47, 12, 31 }, { 20, 55, 22 }, { 8, 30, 38 },
+  { 35, 61, 20 }, { 12, 18, 27 }, { 50, 44, 33 }, { 0, 25, 40 },
+  { 28, 50, 24 }, { 41, 35, 29 }, { 6, 63, 36 }, { 17, 14, 21 },
+  { 33, 47, 39 }, { 45, 22, 26 }, { 10, 58, 30 }, { 24, 38, 34 }
+});
+
+ObjetSimple bench_pool1[BENCH_POOL_MAX];
+ObjetSimple bench_pool2[BENCH_POOL_MAX];
+ObjetMobile bench_mobiles[BENCH_POOL_MAX];
+
+// Grille de bench_pool2: 254 objets au plus, 16 sur AVR (160 octets)
+// (Grid of bench_pool2: 254 objects at most, 16 on AVR)
+#ifdef __AVR__
+#define BENCH_GRILLE_MAX 16
+#else
+#define BENCH_GRILLE_MAX 254
+#endif
+Grille<BENCH_GRILLE_MAX> bench_grille;
+
+// ==========================================================
+// PRÉPARATION (Setup)
+// ==========================================================
+
+void bench_preparerPoints() {
+  proc_init(42);
+  for (int i = 0; i < BENCH_NB_POINTS; i++) {
+    bench_px[i] = proc_random(0, 127);
+    bench_py[i] = proc_random(0, 63);
+  }
+}
+
+// Deux pools dans deux moitiés de l'écran: aucune collision,
+// donc obj_touchePool parcourt TOUTES les paires (pire cas).
+// (Two pools in two screen halves: no hits, so obj_touchePool
+// scans EVERY pair - worst case.)
+void bench_preparerPools(int taille) {
+  proc_init(7);
+  for (int i = 0; i < taille; i++) {
+    bench_pool1[i].x = proc_random(0, 50);
+    bench_pool1[i].y = proc_random(12, 63);
+    bench_pool1[i].largeur = proc_random(20, 40);
+    bench_pool1[i].type = 1;
+    bench_pool1[i].actif = true;
+
+    bench_pool2[i].x = proc_random(70, 120);
+    bench_pool2[i].y = proc_random(12, 63);
+    bench_pool2[i].largeur = 0;
+    bench_pool2[i].type = 1;
+    bench_pool2[i].actif = true;
+
+    bench_mobiles[i].x = proc_random(0, 127);
+    bench_mobiles[i].y = proc_random(0, 63);
+    bench_mobiles[i].vx = proc_random(-2, 2);
+    bench_mobiles[i].vy = proc_random(-2, 2);
+    bench_mobiles[i].largeur = 2;
+    bench_mobiles[i].param = 0;
+    bench_mobiles[i].type = 1;
+    bench_mobiles[i].actif = true;
+  }
+}
+
+// ==========================================================
+// MESURES (Measurements)
+// ==========================================================
+
+void bench_fonctionsSimples() {
+  bench_entete("Physics.h / Procedural.h");
+
+  bench_mesurer("(boucle)", 0, BENCH_N_RAPIDE, [](int i) {
+    bench_puits = i;
+  });
+
+  bench_mesurer("phys_distance", 0, BENCH_N_RAPIDE, [](int i) {
+    int a = i & (BENCH_NB_POINTS - 1);
+    int b = (i + 17) & (BENCH_NB_POINTS - 1);
+    bench_puits = phys_distance(bench_px[a], bench_py[a], bench_px[b], bench_py[b]);
+  });
+
+  bench_mesurer("phys_distanceExacte", 0, BENCH_N_RAPIDE, [](int i) {
+    int a = i & (BENCH_NB_POINTS - 1);
+    int b = (i + 17) & (BENCH_NB_POINTS - 1);
+    bench_puits = phys_distanceExacte(bench_px[a], bench_py[a], bench_px[b], bench_py[b]);
+  });
+
+  bench_mesurer("phys_angle", 0, BENCH_N_RAPIDE, [](int i) {
+    int a = i & (BENCH_NB_POINTS - 1);
+    int b = (i + 17) & (BENCH_NB_POINTS - 1);
+    bench_puits = phys_angle(bench_px[a] - bench_px[b], bench_py[a] - bench_py[b]);
+  });
+
+  // Vitesse fixe 8.8 vers un angle, puis un pas au sous-pixel
+  // (8.8 fixed velocity toward an angle, then one sub-pixel step)
+  bench_mesurer("vitesseAngle + avancer", 0, BENCH_N_RAPIDE, [](int i) {
+    static Corps corps = { 64, 32, 0, 0, 0, 0 };
+    phys_vitesseAngle(i, FIXE(0.75), &corps.vx, &corps.vy);
+    phys_avancerCorps(&corps);
+    bench_puits = corps.x + corps.y;
+  });
+
+  bench_mesurer("phys_toucheBoite", 0, BENCH_N_RAPIDE, [](int i) {
+    int a = i & (BENCH_NB_POINTS - 1);
+    int b = (i + 17) & (BENCH_NB_POINTS - 1);
+    bench_puits = phys_toucheBoite(bench_px[a], bench_py[a], 8, 8,
+                                   bench_px[b], bench_py[b], 8, 8);
+  });
+
+  // Balle 2x2 lancée à 8 pixels par tic contre une brique 18x5
+  // (2x2 ball thrown 8 pixels per tick at an 18x5 brick)
+  bench_mesurer("phys_balayerBoite", 0, BENCH_N_RAPIDE, [](int i) {
+    int a = i & (BENCH_NB_POINTS - 1);
+    int b = (i + 17) & (BENCH_NB_POINTS - 1);
+    Impact impact;
+    bench_puits = phys_balayerBoite(bench_px[a], bench_py[a], 2, 2, (i & 15) - 8, 8 - (i & 7),
+                                    bench_px[b], bench_py[b], 18, 5, &impact);
+  });
+
+  // Monstre contre boss de Sprites.h: points au hasard = surtout
+  // des ratés, puis boîtes qui se chevauchent toujours
+  // (Monster vs boss: random points = mostly misses, then boxes
+  // that always overlap)
+  bench_mesurer("phys_toucheMasques (loin)", 0, BENCH_N_RAPIDE, [](int i) {
+    int a = i & (BENCH_NB_POINTS - 1);
+    int b = (i + 17) & (BENCH_NB_POINTS - 1);
+    bench_puits = phys_toucheMasques(bench_px[a], bench_py[a], spr_monstre_masque, 9, 9,
+                                     bench_px[b], bench_py[b], spr_boss_masque, 15, 15);
+  });
+  bench_mesurer("phys_toucheMasques (pres)", 0, BENCH_N_RAPIDE, [](int i) {
+    int a = i & (BENCH_NB_POINTS - 1);
+    bench_puits = phys_toucheMasques(30 + (bench_px[a] & 15) - 4, 20 + (bench_py[a] & 15) - 4,
+                                     spr_monstre_masque, 9, 9, 30, 20, spr_boss_masque, 15, 15);
+  });
+
+  proc_init(1);
+  bench_mesurer("proc_random", 0, BENCH_N_RAPIDE, [](int i) {
+    bench_puits = proc_random(0, 127);
+  });
+
+  // Joueur au centre: beaucoup d'essais rejetés (pire cas réaliste)
+  // (Player in the middle: many rejected tries - realistic worst case)
+  bench_mesurer("proc_hash", 0, BENCH_N_RAPIDE, [](int i) {
+    bench_puits = proc_hash(3, PROC_FLUX_JEU, i, 0, 127);
+  });
+
+  bench_mesurer("proc_genererLoinDe", 0, BENCH_N_LENT, [](int i) {
+    int x, y;
+    proc_genererLoinDe(i, PROC_FLUX_SPAWN, 0, &x, &y, 64, 32, 50, 10);
+    bench_puits = x + y;
+  });
+
+  bench_mesurer("proc_genererPositionsEsp.", 0, BENCH_N_LENT, [](int i) {
+    int pos[6][2];
+    proc_genererPositionsEspacees(i, PROC_FLUX_SPAWN, pos, 6, 10, 12, PROC_SPAWN_ESPACEMENT);
+    bench_puits = pos[5][0];
+  });
+
+  bench_mesurer("proc_genererPlateformes", 0, BENCH_N_LENT, [](int i) {
+    int plat[5][3];
+    bench_puits = proc_genererPlateformes(6 + i, plat, 5, 1 + i % 3);
+  });
+
+  // Un morceau de monde qui défile: le coût max d'une image
+  // (One scrolling-world chunk: the worst cost in a frame)
+  static ProcMonde monde;
+  proc_mondeDebut(&monde, 6, PROC_MONDE_MORCEAUX_MAX, 3);
+  bench_mesurer("proc_mondePas", 0, BENCH_N_RAPIDE, [](int i) {
+    if (proc_mondeTermine(&monde)) proc_mondeDebut(&monde, 6 + i, PROC_MONDE_MORCEAUX_MAX, 3);
+    proc_mondePas(&monde);
+    bench_puits = monde.y;
+  });
+
+  // Bruit: coût par échantillon (Noise: cost per sample)
+  bench_mesurer("proc_bruit1D", 0, BENCH_N_RAPIDE, [](int i) {
+    bench_puits = proc_bruit1D((uint16_t)i * 37, 5);
+  });
+
+  bench_mesurer("proc_bruit2D", 0, BENCH_N_RAPIDE, [](int i) {
+    bench_puits = proc_bruit2D((uint16_t)i * 37, (uint16_t)i * 11, 5);
+  });
+
+  bench_mesurer("proc_ligneBruit (3 oct.)", 0, BENCH_N_RAPIDE, [](int i) {
+    bench_puits = proc_ligneBruit(i, 5, 5, 40, 60);
+  });
+
+  bench_mesurer("proc_texture", 0, BENCH_N_RAPIDE, [](int i) {
+    bench_puits = proc_texture(i & 127, i >> 7, 5, 3, 90);
+  });
+
+  // Fond d'une image entière: 8 pages, décalage vertical (pire cas)
+  // (Background of a whole frame: 8 pages, vertical offset - worst case)
+  bench_mesurer("proc_fondPage (8 pages)", 0, BENCH_N_LENT, [](int i) {
+    static uint8_t tampon[PROC_ECRAN_LARGEUR];
+    for (uint8_t page = 0; page < 8; page++) {
+      proc_fondPage(tampon, page, 5, i, 3, 255);
+    }
+    bench_puits = tampon[i & 127];
+  });
+}
+
+// Pool<T, N> contre tableau + bool actif. Pool presque plein: la
+// recherche d'une case libre est au pire. Puis 1 case sur 8
+// vivante: la boucle ne voit que celles-là.
+// (Pool<T, N> vs array + bool actif. Nearly full pool: the free
+// slot search is at its worst. Then 1 slot in 8 alive: the loop
+// only sees those.)
+template <uint8_t N>
+void bench_poolBits() {
+  static Pool<ObjetLeger, N> pool;
+  pool.vider();
+  obj_initialiser(bench_pool1, N);
+  for (int i = 0; i < N - 1; i++) {
+    pool.creer();
+    bench_pool1[i].actif = true;
+  }
+
+  bench_mesurer("obj_trouverLibre", N, BENCH_N_RAPIDE, [](int i) {
+    bench_puits = obj_trouverLibre(bench_pool1, N);
+  });
+  bench_mesurer("Pool::creer", N, BENCH_N_RAPIDE, [](int i) {
+    int j = pool.creer();
+    pool.liberer(j);
+    bench_puits = j;
+  });
+
+  pool.vider();
+  obj_initialiser(bench_pool1, N);
+  for (int i = 0; i < N; i++) {
+    int j = pool.creer();
+    pool[j].x = i;
+    bench_pool1[i].x = i;
+    bench_pool1[i].actif = true;
+  }
+  for (int i = 0; i < N; i++) {
+    if (i & 7) {
+      pool.liberer(i);
+      bench_pool1[i].actif = false;
+    }
+  }
+
+  bench_mesurer("POUR_CHAQUE (bool, 1/8)", N, BENCH_N_RAPIDE, [](int i) {
+    int somme = 0;
+    for (int k = 0; k < N; k++) {
+      if (bench_pool1[k].actif) somme += bench_pool1[k].x;
+    }
+    bench_puits = somme;
+  });
+  bench_mesurer("POUR_CHAQUE_VIVANT (1/8)", N, BENCH_N_RAPIDE, [](int i) {
+    int somme = 0;
+    POUR_CHAQUE_VIVANT(pool, o) { somme += o.x; }
+    bench_puits = somme;
+  });
+}
+
+// Un système d'Entites<N>: 1 entité sur 3 a position + vitesse,
+// les autres sont de la nourriture immobile. Le coût suit N,
+// pas le mélange. (One Entites<N> system: 1 entity in 3 has
+// position + velocity, the rest is still food. The cost
+// follows N, not the mix.)
+#define BENCH_ENT_POSITION ENT_COMPOSANT(0)
+#define BENCH_ENT_VITESSE  ENT_COMPOSANT(1)
+template <uint8_t N>
+void bench_entites() {
+  static Entites<N> monde;
+  static int8_t x[N];
+  static int8_t vx[N];
+  monde.vider();
+  for (uint8_t k = 0; k < N; k++) {
+    uint8_t e = monde.creer(k % 3 ? BENCH_ENT_POSITION : BENCH_ENT_POSITION | BENCH_ENT_VITESSE);
+    x[e] = k;
+    vx[e] = 1;
+  }
+
+  bench_mesurer("POUR_CHAQUE_ENTITE (1/3)", N, BENCH_N_RAPIDE, [](int i) {
+    POUR_CHAQUE_ENTITE(monde, BENCH_ENT_POSITION | BENCH_ENT_VITESSE, e) {
+      x[e] = x[e] + vx[e];
+    }
+    bench_puits = x[0];
+  });
+}
+
+// ObjetMobile[N] contre MobilesSoA<N>, tous actifs, marge 128:
+// on mesure le mouvement seul (All active, margin 128: pure movement)
+template <uint16_t N>
+void bench_mobilesSoA() {
+  static ObjetMobile aos[N];
+  static MobilesSoA<N> soa;
+  proc_init(11);
+  objm_initialiser(aos, N);
+  objm_initialiser(&soa);
+  for (uint16_t i = 0; i < N; i++) {
+    int x = proc_random(0, 127);
+    int y = proc_random(0, 63);
+    int vx = proc_random(-2, 2);
+    int vy = proc_random(-2, 2);
+    objm_creer(aos, N, x, y, vx, vy, 2, 0, 1);
+    objm_creer(&soa, x, y, vx, vy, 2, 0, 1);
+  }
+
+  bench_mesurer("objm_bougerTous", N, BENCH_N_LENT, [](int i) {
+    objm_bougerTous(aos, N, 128);
+    bench_puits = aos[0].x;
+  });
+  bench_mesurer("objm_bougerTous (SoA)", N, BENCH_N_LENT, [](int i) {
+    objm_bougerTous(&soa, 128);
+    bench_puits = soa.x[0];
+  });
+  bench_mesurer("objm_bougerVersCible", N, BENCH_N_LENT, [](int i) {
+    objm_bougerVersCible(aos, N, i & 127, i & 63);
+    bench_puits = aos[0].x;
+  });
+  bench_mesurer("objm_bougerVersCible (SoA)", N, BENCH_N_LENT, [](int i) {
+    objm_bougerVersCible(&soa, i & 127, i & 63);
+    bench_puits = soa.x[0];
+  });
+}
+
+void bench_pools() {
+  bench_entete("Objects.h");
+
+  for (int t = 0; t < BENCH_NB_TAILLES; t++) {
+    int taille = bench_taillesPool[t];
+    bench_preparerPools(taille);
+
+    bench_mesurer("obj_touchePool", taille, BENCH_N_LENT, [taille](int i) {
+      int j = -1;
+      bench_puits = obj_touchePool(bench_pool1, taille, bench_pool2, taille, 4, &j) + j;
+    });
+
+    // Grille reconstruite à chaque appel, comme à chaque tic
+    // (Grid rebuilt on every call, like every tick)
+    if (taille <= BENCH_GRILLE_MAX) {
+      bench_mesurer("grille_touchePool", taille, BENCH_N_LENT, [taille](int i) {
+        int j = -1;
+        grille_construire(&bench_grille, bench_pool2, taille);
+        bench_puits = grille_touchePool(&bench_grille, bench_pool2, bench_pool1, taille, 4, &j) + j;
+      });
+    }
+
+    // marge 128: rien n'est jamais supprimé, on mesure le mouvement seul
+    // (margin 128: nothing is ever removed, measures pure movement)
+    bench_mesurer("objm_bougerTous", taille, BENCH_N_LENT, [taille](int i) {
+      objm_bougerTous(bench_mobiles, taille, 128);
+      bench_puits = bench_mobiles[0].x;
+    });
+
+    // Pied au-dessus de tout: aucune plateforme trouvée (pire cas)
+    // (Foot above everything: no platform found - worst case)
+    bench_mesurer("obj_surPlateforme", taille, BENCH_N_LENT, [taille](int i) {
+      bench_puits = obj_surPlateforme(bench_pool1, taille, i & 63, 2, 1);
+    });
+  }
+
+  // Rangement en colonnes (Struct-of-arrays). Sur AVR, 64 + 64
+  // objets de plus ne tiennent pas à côté des pools ci-dessus.
+  // (On AVR, 64 + 64 more objects don't fit next to the pools above.)
+  bench_mobilesSoA<8>();
+#ifndef __AVR__
+  bench_mobilesSoA<64>();
+  bench_mobilesSoA<1024>();
+#endif
+
+  bench_poolBits<6>();
+  bench_poolBits<16>();
+#ifndef __AVR__
+  bench_poolBits<64>();  // 267 octets de plus: trop pour l'AVR (too much for AVR)
+#endif
+
+  bench_entites<6>();
+  bench_entites<16>();
+#ifndef __AVR__
+  bench_entites<64>();
+#endif
+
+  // Même recherche, lue en Flash: 0 octet de RAM (Same search from Flash)
+  PmArray<PmPlateforme> platFlash = pm_tableau(bench_platFlash);
+  bench_mesurer("obj_surPlateformeFlash", platFlash.taille, BENCH_N_LENT, [platFlash](int i) {
+    bench_puits = obj_surPlateformeFlash(platFlash, i & 63, 2, 1);
+  });
+
+  // La carte d'abord: elle dit "rien" sans lire une plateforme
+  // (Map first: it says "nothing" without reading one platform)
+  CarteCollision carte;
+  carte_vider(&carte);
+  carte_ajouterPlateformes(&carte, platFlash);
+  bench_mesurer("carte + Flash (en l'air)", platFlash.taille, BENCH_N_LENT, [platFlash, &carte](int i) {
+    bench_puits = carte_solPossible(&carte, i & 63, 2) ? obj_surPlateformeFlash(platFlash, i & 63, 2, 1) : -1;
+  });
+
+  // Pied posé sur une plateforme: la carte dit "peut-être", on cherche
+  // (Foot on a platform: the map says "maybe", then we search)
+  bench_mesurer("carte + Flash (au sol)", platFlash.taille, BENCH_N_LENT, [platFlash, &carte](int i) {
+    bench_puits = carte_solPossible(&carte, 30 + (i & 7), 62) ? obj_surPlateformeFlash(platFlash, 30 + (i & 7), 62, 1) : -1;
+  });
+
+  bench_mesurer("carte_occupe", 1, BENCH_N_RAPIDE, [&carte](int i) {
+    int a = i & (BENCH_NB_POINTS - 1);
+    bench_puits = carte_occupe(&carte, bench_px[a], bench_py[a]);
+  });
+}
+
+// Décompression: niveau entier vers la RAM, puis 16 octets
+// par page comme DESSINER_ECRAN (une ligne de tuiles).
+// (Decompression: whole level to RAM, then 16 bytes per page
+// like DESSINER_ECRAN - one row of tiles.)
+// minu_jeu avec 8 minuteries périodiques (1 à 200 tours): un
+// tour ne touche que celles qui sonnent ou descendent de niveau.
+// (minu_jeu with 8 periodic timers - 1 to 200 ticks: a tick only
+// touches the ones that ring or move down a level.)
+void bench_minuteries() {
+  bench_entete("Minuteries.h");
+
+  minu_vider(&minu_jeu);
+  static const uint8_t periodes[MINU_MAX] = { 1, 3, 4, 7, 16, 30, 60, 200 };
+  for (uint8_t id = 0; id < MINU_MAX; id++) {
+    minu_lancer(&minu_jeu, id, periodes[id], periodes[id]);
+  }
+  bench_mesurer("minu_avancer (8 actives)", MINU_MAX, BENCH_N_RAPIDE, [](int i) {
+    minu_avancer(&minu_jeu);
+    bench_puits = minu_sonne(&minu_jeu, 0);
+  });
+  bench_mesurer("minu_lancer + arreter", MINU_MAX, BENCH_N_RAPIDE, [](int i) {
+    minu_lancer(&minu_jeu, 7, i & 127, 0);
+    minu_arreter(&minu_jeu, 7);
+    bench_puits = minu_jeu.tetes[0];
+  });
+  minu_vider(&minu_jeu);
+}
+
+// Un tour de Breakout chargé: bloc, points, mur, puis tout
+// traiter (A busy Breakout tick: block, points, wall, then
+// handle them all)
+void bench_compterEvenement(const Evenement* e) {
+  bench_puits += e->valeur;
+}
+
+void bench_evenements() {
+  bench_entete("GameBase.h");
+
+  evt_vider();
+  bench_mesurer("evt_poster x3 + traiter", 3, BENCH_N_RAPIDE, [](int i) {
+    evt_poster(EVT_TOUCHE, 0);
+    evt_poster(EVT_POINTS, 10);
+    evt_poster(EVT_TOUCHE, 2);
+    evt_traiter(bench_compterEvenement);
+  });
+}
+
+// Une tâche qui cède à chaque passage (A task yielding every pass)
+bool bench_tacheCeder(Tache* t) {
+  TACHE_DEBUT(t);
+  while (true) {
+    bench_puits++;
+    TACHE_CEDER(t);
+  }
+  TACHE_FIN(t);
+}
+
+void bench_taches() {
+  bench_entete("Taches.h");
+
+  tache_lancer(bench_tacheCeder);
+  bench_mesurer("taches_avancer (1 prete)", 1, BENCH_N_RAPIDE, [](int i) {
+    taches_avancer();
+  });
+  tache_arreter(bench_tacheCeder);
+}
+
+void bench_paquets() {
+  bench_entete("ProgMem.h");
+
+  static uint8_t tampon[BENCH_TAMPON_PAQUET];
+  const uint8_t* carte = pm_packDonnee(bench_pack, BENCH_PACK_CARTE);
+  const uint8_t* textes = pm_packDonnee(bench_pack, BENCH_PACK_TEXTES);
+  int tailleCarte = pm_donneeTaille(carte);
+  int tailleTextes = pm_donneeTaille(textes);
+  int lusCarte = tailleCarte < BENCH_TAMPON_PAQUET ? tailleCarte : BENCH_TAMPON_PAQUET;
+
+  bench_mesurer("pm_decompresser (carte)", lusCarte, BENCH_N_LENT, [](int i) {
+    bench_puits = pm_decompresser(bench_pack, BENCH_PACK_CARTE, tampon, sizeof(tampon));
+  });
+  bench_mesurer("pm_decompresser (textes)", tailleTextes, BENCH_N_LENT, [](int i) {
+    bench_puits = pm_decompresser(bench_pack, BENCH_PACK_TEXTES, tampon, sizeof(tampon));
+  });
+
+  // Référence: même taille lue sans compression (table de 256 octets)
+  // (Reference: same size read uncompressed - 256-byte table)
+  bench_mesurer("pgm_read_byte (carte)", lusCarte, BENCH_N_LENT, [lusCarte](int i) {
+    for (int k = 0; k < lusCarte; k++) tampon[k] = pgm_read_byte(&proc_permutation[k & 255]);
+    bench_puits = tampon[i & 255];
+  });
+
+  static PmFlux flux;
+  pm_fluxOuvrir(&flux, carte);
+  bench_mesurer("pm_fluxLireBloc (page)", 16, BENCH_N_RAPIDE, [carte](int i) {
+    if (pm_fluxFini(&flux)) pm_fluxOuvrir(&flux, carte);
+    bench_puits = pm_fluxLireBloc(&flux, tampon, 16);
+  });
+
+  // Flash gagnée = brut - (jetons + 2 octets de taille)
+  // (Flash saved = raw - (tokens + 2 size bytes))
+  bench_flash("carte", tailleCarte, (int)(textes - carte));
+  bench_flash("textes", tailleTextes, (int)(sizeof(bench_pack) - (textes - bench_pack)));
+  bench_flash("paquet + table", tailleCarte + tailleTextes, (int)sizeof(bench_pack));
+}
+
+// ==========================================================
+// DISPLAY.H - sprites contre primitives (sprites vs primitives)
+// ==========================================================
+// Un écran complet = 8 pages, comme DESSINER_ECRAN. La ligne
+// "ecran vide" est le prix des 8 pages sans rien dedans: à
+// soustraire des autres. Les primitives sont celles du
+// remplaçant U8g2 de tools/host (sur AVR aussi), pas celles
+// de la vraie bibliothèque.
+// (One full screen = 8 pages, like DESSINER_ECRAN. The "ecran
+// vide" row is the cost of 8 empty pages: subtract it from
+// the others. Primitives come from the U8g2 stand-in in
+// tools/host - on AVR too - not from the real library.)
+void bench_ecran() {
+  bench_entete("Display.h (8 pages)");
+
+  bench_mesurer("ecran vide", 0, BENCH_N_LENT, [](int i) {
+    DESSINER_ECRAN { }
+  });
+
+  // Porte de l'Aventurier (Aventurier door)
+  bench_mesurer("porte: primitives", 1, BENCH_N_LENT, [](int i) {
+    int x = 20 + (i & 63);
+    DESSINER_ECRAN {
+      dessinerContour(x, 21, 8, 14);
+      dessinerCercle(x + 5, 28, 1);
+    }
+  });
+  bench_mesurer("porte: sprite y=16", 1, BENCH_N_LENT, [](int i) {
+    int x = 20 + (i & 63);
+    DESSINER_ECRAN { dessinerSprite(x, 16, &spr_porte, 0); }
+  });
+  bench_mesurer("porte: sprite y=21", 1, BENCH_N_LENT, [](int i) {
+    int x = 20 + (i & 63);
+    DESSINER_ECRAN { dessinerSprite(x, 21, &spr_porte, 0); }
+  });
+
+  // Monstre et boss de Monster Hunter (Monster Hunter foes)
+  bench_mesurer("monstre: dessinerTriangle", 1, BENCH_N_LENT, [](int i) {
+    int x = 20 + (i & 63);
+    DESSINER_ECRAN { dessinerTriangle(x + 8, 25, x, 21, x, 29); }
+  });
+  bench_mesurer("monstre: sprite", 1, BENCH_N_LENT, [](int i) {
+    int x = 20 + (i & 63);
+    DESSINER_ECRAN { dessinerSprite(x, 21, &spr_monstre, i & 7); }
+  });
+  bench_mesurer("boss: dessinerTriangle", 1, BENCH_N_LENT, [](int i) {
+    int x = 20 + (i & 63);
+    DESSINER_ECRAN { dessinerTriangle(x + 14, 28, x, 21, x, 35); }
+  });
+  bench_mesurer("boss: sprite", 1, BENCH_N_LENT, [](int i) {
+    int x = 20 + (i & 63);
+    DESSINER_ECRAN { dessinerSprite(x, 21, &spr_boss, i & 7); }
+  });
+
+  // Champion de Personnages.h: formes contre image pré-dessinée
+  // (Champion: shapes vs pre-drawn picture)
+  bench_mesurer("champion: formes", 1, BENCH_N_LENT, [](int i) {
+    int x = 20 + (i & 63);
+    DESSINER_ECRAN { pers_dessinerPlateformeFormes(x, 30, PERSO_CHAMPION, DIR_DROITE, i & 1); }
+  });
+  bench_mesurer("champion: image", 1, BENCH_N_LENT, [](int i) {
+    int x = 20 + (i & 63);
+    DESSINER_ECRAN { pers_dessinerPlateforme(x, 30, PERSO_CHAMPION, DIR_DROITE, i & 1); }
+  });
+  bench_mesurer("champion vue haut: formes", 1, BENCH_N_LENT, [](int i) {
+    int x = 20 + (i & 63);
+    DESSINER_ECRAN { pers_dessinerVueHautFormes(x, 30, PERS_TAILLE_VUE_HAUT, PERSO_CHAMPION, i & 3); }
+  });
+  bench_mesurer("champion vue haut: image", 1, BENCH_N_LENT, [](int i) {
+    int x = 20 + (i & 63);
+    DESSINER_ECRAN { pers_dessinerVueHaut(x, 30, PERS_TAILLE_VUE_HAUT, PERSO_CHAMPION, i & 3); }
+  });
+}
+
+// ==========================================================
+// PROGRAMME PRINCIPAL (Main program)
+// ==========================================================
+
+int main() {
+  bench_demarrer();
+  bench_preparerPoints();
+
+  bench_fonctionsSimples();
+  bench_pools();
+  bench_minuteries();
+  bench_evenements();
+  bench_taches();
+  bench_paquets();
+  bench_ecran();
+
+  bench_terminer();
+  return 0;
+}
@@ -0,0 +1,48 @@
+// ==========================================================
+// ARDUINO.H - Remplaçant PC du coeur Arduino
+// (PC stand-in for the Arduino core)
+// ==========================================================
+// Juste assez pour compiler les fichiers du jeu sur
+// l'ordinateur, pour les outils (validateur, benchmarks).
+// Pas d'écran, pas de son, pas de joystick!
+// (Just enough to compile the game headers on the computer,
+// for tools. No screen, no sound, no joystick!)
+// ==========================================================
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <avr/pgmspace.h>
+
+#define A0 14
+#define A1 15
+#define A2 16
+#define LOW 0
+#define HIGH 1
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+
+typedef uint8_t byte;
+
+inline void pinMode(uint8_t, uint8_t) { }
+inline int digitalRead(uint8_t) { return HIGH; }  // Bouton relâché (Button up)
+inline int analogRead(uint8_t) { return 512; }    // Joystick au centre (Centred)
+inline void tone(uint8_t, unsigned int, unsigned long = 0) { }
+inline void noTone(uint8_t) { }
+inline void delay(unsigned long) { }
+inline unsigned long millis() { return 0; }
+inline void randomSeed(unsigned long) { }
+
+#ifndef __AVR__
+inline char* itoa(int valeur, char* texte, int) {
+  sprintf(texte, "%d", valeur);
+  return texte;
+}
+#endif
+
+#endif
@@ -0,0 +1,256 @@
+// ==========================================================
+// U8G2LIB.H - Remplaçant PC de l'écran U8g2
+// (PC stand-in for the U8g2 screen)
+// ==========================================================
+// Dessine VRAIMENT dans un buffer de page de 128 octets, comme
+// le mode "_1_" de U8g2: chaque appel ne touche que les 8
+// lignes de la page en cours. Assez proche de U8g2 pour
+// mesurer les primitives (make bench) et pour pré-dessiner
+// des images; le texte n'est pas dessiné.
+// (REALLY draws into a 128-byte page buffer, like U8g2's "_1_"
+// mode: each call only touches the 8 rows of the current page.
+// Close enough to U8g2 to measure primitives (make bench) and
+// to pre-draw pictures; text is not drawn.)
+// ==========================================================
+
+#ifndef HOST_U8G2LIB_H
+#define HOST_U8G2LIB_H
+
+#include <stdint.h>
+
+#define U8G2_R0 0
+#define U8X8_PIN_NONE 255
+
+static const uint8_t u8g2_font_6x10_tf[1] = { 0 };
+static const uint8_t u8g2_font_7x14_tf[1] = { 0 };
+
+class U8G2_SSD1306_128X64_NONAME_1_HW_I2C {
+public:
+  U8G2_SSD1306_128X64_NONAME_1_HW_I2C(int, int) { }
+  void begin() { }
+  void setFont(const uint8_t*) { }
+  void drawStr(int, int, const char*) { }
+
+  void drawPixel(int x, int y) {
+    int ligne = y - page * 8;
+    if (x < 0 || x >= 128 || ligne < 0 || ligne >= 8) return;
+    tampon[x] |= 1 << ligne;
+  }
+
+  void drawHLine(int x, int y, int largeur) {
+    for (int i = 0; i < largeur; i++) drawPixel(x + i, y);
+  }
+
+  void drawVLine(int x, int y, int hauteur) {
+    for (int i = 0; i < hauteur; i++) drawPixel(x, y + i);
+  }
+
+  void drawBox(int x, int y, int largeur, int hauteur) {
+    for (int i = 0; i < hauteur; i++) drawHLine(x, y + i, largeur);
+  }
+
+  void drawFrame(int x, int y, int largeur, int hauteur) {
+    drawHLine(x, y, largeur);
+    drawHLine(x, y + hauteur - 1, largeur);
+    drawVLine(x, y + 1, hauteur - 2);
+    drawVLine(x + largeur - 1, y + 1, hauteur - 2);
+  }
+
+  // Cercle plein, même algorithme que U8g2 (Filled circle, U8g2's algorithm)
+  void drawDisc(int x0, int y0, int rayon) {
+    int f = 1 - rayon;
+    int ddFx = 1;
+    int ddFy = -2 * rayon;
+    int x = 0;
+    int y = rayon;
+    sectionDisque(x, y, x0, y0);
+    while (x < y) {
+      if (f >= 0) {
+        y--;
+        ddFy += 2;
+        f += ddFy;
+      }
+      x++;
+      ddFx += 2;
+      f += ddFx;
+      sectionDisque(x, y, x0, y0);
+    }
+  }
+
+  // Bresenham, comme U8g2 (Bresenham, like U8g2)
+  void drawLine(int x1, int y1, int x2, int y2) {
+    int dx = x1 > x2 ? x1 - x2 : x2 - x1;
+    int dy = y1 > y2 ? y1 - y2 : y2 - y1;
+    bool echange = dy > dx;
+    if (echange) {
+      int t = dx; dx = dy; dy = t;
+      t = x1; x1 = y1; y1 = t;
+      t = x2; x2 = y2; y2 = t;
+    }
+    if (x1 > x2) {
+      int t = x1; x1 = x2; x2 = t;
+      t = y1; y1 = y2; y2 = t;
+    }
+    int erreur = dx >> 1;
+    int pas = y2 > y1 ? 1 : -1;
+    int y = y1;
+    for (int x = x1; x <= x2; x++) {
+      if (echange) drawPixel(y, x);
+      else drawPixel(x, y);
+      erreur -= dy;
+      if (erreur < 0) {
+        y += pas;
+        erreur += dx;
+      }
+    }
+  }
+
+  // Triangle plein: même remplissage par lignes que
+  // u8g2_DrawTriangle (u8g2_polygon.c), pour que les images
+  // pré-dessinées soient celles de l'écran au pixel près.
+  // Une ligne va de x gauche (inclus) à x droit (exclu), la
+  // dernière ligne n'est pas dessinée, ni la première si le
+  // haut est une pointe.
+  // (Filled: the same scanline fill as u8g2_DrawTriangle, so
+  // pre-drawn pictures match the screen to the pixel. A row
+  // goes from left x (included) to right x (excluded), the last
+  // row is not drawn, nor the first one if the top is a point.)
+  void drawTriangle(int x1, int y1, int x2, int y2, int x3, int y3) {
+    int px[3] = { x1, x2, x3 };
+    int py[3] = { y1, y2, y3 };
+
+    // Sommet le plus haut et ligne la plus basse
+    // (Highest vertex and lowest row)
+    int haut = 0;
+    int yMax = py[0];
+    for (int i = 1; i < 3; i++) {
+      if (py[i] > yMax) yMax = py[i];
+      if (py[i] < py[haut]) haut = i;
+    }
+    int nbLignes = yMax - py[haut];
+    if (nbLignes == 0) return;
+
+    // Haut plat: chaque bord avance tant que y ne change pas
+    // (Flat top: each edge moves on while y stays the same)
+    int gauche = haut;
+    int droite = haut;
+    while (py[suivant(droite, 1)] == py[haut]) droite = suivant(droite, 1);
+    while (py[suivant(gauche, -1)] == py[haut]) gauche = suivant(gauche, -1);
+
+    bool pointe = true;
+    if (px[gauche] != px[droite]) {
+      pointe = false;
+    } else {
+      nbLignes--;
+      if (nbLignes == 0) return;
+    }
+
+    BordTriangle bg, bd;
+    bordSuivant(&bg, &gauche, -1, px, py);
+    bordSuivant(&bd, &droite, 1, px, py);
+    if (pointe) {
+      bordAvancer(&bg);
+      bordAvancer(&bd);
+    }
+
+    do {
+      int xa = bg.x;
+      int xb = bd.x;
+      if (xa < xb) drawHLine(xa, bd.y, xb - xa);
+      else drawHLine(xb, bd.y, xa - xb);
+      while (!bordAvancer(&bg)) bordSuivant(&bg, &gauche, -1, px, py);
+      while (!bordAvancer(&bd)) bordSuivant(&bd, &droite, 1, px, py);
+      nbLignes--;
+    } while (nbLignes > 0);
+  }
+
+  // 8 pages de 8 lignes (8 pages of 8 rows)
+  void firstPage() { page = 0; effacer(); }
+  uint8_t nextPage() { page++; effacer(); return page < 8; }
+
+  uint8_t* getBufferPtr() { return tampon; }
+  uint8_t getBufferCurrTileRow() { return page; }
+
+  uint8_t page = 0;
+  uint8_t tampon[128] = { 0 };
+
+private:
+  void effacer() {
+    for (int i = 0; i < 128; i++) tampon[i] = 0;
+  }
+
+  void sectionDisque(int x, int y, int x0, int y0) {
+    drawVLine(x0 + x, y0 - y, y + 1);
+    drawVLine(x0 + y, y0 - x, x + 1);
+    drawVLine(x0 - x, y0 - y, y + 1);
+    drawVLine(x0 - y, y0 - x, x + 1);
+    drawVLine(x0 + x, y0, y + 1);
+    drawVLine(x0 + y, y0, x + 1);
+    drawVLine(x0 - x, y0, y + 1);
+    drawVLine(x0 - y, y0, x + 1);
+  }
+
+  // Un bord du triangle, suivi ligne par ligne avec l'erreur
+  // de Bresenham de U8g2 (pg_edge_struct)
+  // (One triangle edge, followed row by row with U8g2's
+  // Bresenham error)
+  struct BordTriangle {
+    int direction;
+    int hauteur;
+    int pasX;
+    int pasErreur;
+    int y;
+    int yMax;
+    int x;
+    int erreur;
+  };
+
+  static int suivant(int i, int sens) {
+    return (i + sens + 3) % 3;
+  }
+
+  // Bord du sommet *i au sommet suivant dans le sens donné
+  // (Edge from vertex *i to the next one in the given direction)
+  static void bordSuivant(BordTriangle* b, int* i, int sens, const int* px, const int* py) {
+    int x1 = px[*i];
+    int y1 = py[*i];
+    *i = suivant(*i, sens);
+    int dx = px[*i] - x1;
+    b->hauteur = py[*i] - y1;
+    b->yMax = py[*i];
+    b->y = y1;
+    b->x = x1;
+    int largeur;
+    if (dx >= 0) {
+      b->direction = 1;
+      largeur = dx;
+      b->erreur = 0;
+    } else {
+      b->direction = -1;
+      largeur = -dx;
+      b->erreur = 1 - b->hauteur;
+    }
+    // Bord horizontal: U8g2 divise par zéro ici, sans effet
+    // car il passe au bord suivant tout de suite
+    // (Flat edge: U8g2 divides by zero here, with no effect as
+    // it moves on to the next edge at once)
+    b->pasX = b->hauteur != 0 ? dx / b->hauteur : 0;
+    b->pasErreur = b->hauteur != 0 ? largeur % b->hauteur : 0;
+  }
+
+  // Ligne suivante; false si le bord est fini
+  // (Next row; false if the edge is done)
+  static bool bordAvancer(BordTriangle* b) {
+    if (b->y >= b->yMax) return false;
+    b->x += b->pasX;
+    b->erreur += b->pasErreur;
+    if (b->erreur > 0) {
+      b->x += b->direction;
+      b->erreur -= b->hauteur;
+    }
+    b->y++;
+    return true;
+  }
+};
+
+#endif
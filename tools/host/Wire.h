@@ -0,0 +1,4 @@
+// Remplaçant PC de Wire.h: rien à faire (PC stand-in: nothing to do)
+#ifndef HOST_WIRE_H
+#define HOST_WIRE_H
+#endif
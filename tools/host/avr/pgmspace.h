@@ -0,0 +1,32 @@
+// ==========================================================
+// AVR/PGMSPACE.H - Remplaçant PC de <avr/pgmspace.h>
+// (PC stand-in for <avr/pgmspace.h>)
+// ==========================================================
+// Sur PC il n'y a pas de mémoire Flash séparée: PROGMEM ne
+// fait rien et pgm_read_* lit simplement la RAM.
+// Permet de compiler Physics.h, Objects.h, Procedural.h...
+// sur l'ordinateur pour les benchmarks et les outils.
+// (On PC there is no separate Flash: PROGMEM does nothing
+// and pgm_read_* just reads RAM. Lets the engine headers
+// compile on the host for benchmarks and tools.)
+// ==========================================================
+
+#ifndef HOST_AVR_PGMSPACE_H
+#define HOST_AVR_PGMSPACE_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define PSTR(s) (s)
+
+#define pgm_read_byte(adr)  (*(const uint8_t*)(adr))
+#define pgm_read_word(adr)  (*(const uint16_t*)(adr))
+#define pgm_read_dword(adr) (*(const uint32_t*)(adr))
+#define pgm_read_ptr(adr)   (*(const void* const*)(adr))
+
+#define memcpy_P  memcpy
+#define strncpy_P strncpy
+#define strlen_P  strlen
+
+#endif
@@ -0,0 +1,210 @@
+#!/usr/bin/env python3
+# ==========================================================
+# PACKER.PY - Compresse des données pour la Flash
+# (Compresses data for Flash)
+# ==========================================================
+# Fabrique un "paquet" lu par pm_fluxLire / pm_decompresser
+# de ProgMem.h. Chaque donnée est compressée à part, avec des
+# jetons LITTÉRAL / RÉPÉTER / COPIER (voir ProgMem.h).
+# (Builds a "pack" read by pm_fluxLire / pm_decompresser in
+# ProgMem.h. Each entry is compressed on its own with
+# LITERAL / REPEAT / COPY tokens - see ProgMem.h.)
+#
+# Fichiers d'entrée (Input files):
+#   *.txt  -> nombres séparés par des virgules ou espaces,
+#             commentaires "//" permis (0x.. accepté)
+#   autre  -> octets bruts (raw bytes)
+#
+# Usage:
+#   python3 tools/packer/packer.py -o Game/PackCartes.h -n carte_pack \
+#       MONDE1=assets/monde1.txt MONDE2=assets/monde2.txt
+#
+# Le paquet est décompressé ici même avant d'écrire le .h:
+# si le format change d'un côté, le packer refuse.
+# (The pack is decompressed right here before writing the .h:
+# if the format changes on one side, the packer refuses.)
+# ==========================================================
+
+import argparse
+import os
+import re
+import sys
+
+FENETRE = 64        # PM_FENETRE dans ProgMem.h
+LITTERAL_MAX = 128
+REPETER_MAX = 66
+COPIER_MAX = 66
+MIN_JETON = 3
+
+
+# ==========================================================
+# COMPRESSION
+# ==========================================================
+
+def compresser(donnees):
+    """Jetons gloutons: le plus long entre répéter et copier."""
+    sortie = bytearray()
+    litteraux = bytearray()
+
+    def vider():
+        while litteraux:
+            bloc = litteraux[:LITTERAL_MAX]
+            sortie.append(len(bloc) - 1)
+            sortie.extend(bloc)
+            del litteraux[:LITTERAL_MAX]
+
+    i = 0
+    n = len(donnees)
+    while i < n:
+        # Répétition du même octet (Run of the same byte)
+        repetition = 1
+        while i + repetition < n and repetition < REPETER_MAX and donnees[i + repetition] == donnees[i]:
+            repetition += 1
+
+        # Copie depuis la fenêtre, chevauchement permis (Copy from window, overlap allowed)
+        copie, distance = 0, 0
+        for d in range(1, min(FENETRE, i) + 1):
+            longueur = 0
+            while i + longueur < n and longueur < COPIER_MAX and donnees[i + longueur] == donnees[i + longueur - d]:
+                longueur += 1
+            if longueur > copie:
+                copie, distance = longueur, d
+
+        if repetition >= MIN_JETON and repetition >= copie:
+            vider()
+            sortie.append(0x80 | (repetition - MIN_JETON))
+            sortie.append(donnees[i])
+            i += repetition
+        elif copie >= MIN_JETON:
+            vider()
+            sortie.append(0xC0 | (copie - MIN_JETON))
+            sortie.append(distance - 1)
+            i += copie
+        else:
+            litteraux.append(donnees[i])
+            i += 1
+    vider()
+    return bytes(sortie)
+
+
+def decompresser(jetons, taille):
+    """Même algorithme que pm_fluxLire (Same algorithm as pm_fluxLire)."""
+    sortie = bytearray()
+    i = 0
+    while len(sortie) < taille:
+        c = jetons[i]
+        i += 1
+        if c < 0x80:
+            sortie.extend(jetons[i:i + c + 1])
+            i += c + 1
+        elif c < 0xC0:
+            sortie.extend(bytes([jetons[i]]) * ((c & 0x3F) + MIN_JETON))
+            i += 1
+        else:
+            distance = jetons[i] + 1
+            i += 1
+            for _ in range((c & 0x3F) + MIN_JETON):
+                sortie.append(sortie[-distance])
+    return bytes(sortie[:taille])
+
+
+# ==========================================================
+# PAQUET (Pack)
+# ==========================================================
+
+def lire_fichier(chemin):
+    if chemin.endswith(".txt"):
+        with open(chemin, encoding="utf-8") as f:
+            texte = re.sub(r"//[^\n]*", "", f.read())
+        valeurs = [int(v, 0) for v in re.split(r"[\s,]+", texte) if v]
+        for v in valeurs:
+            if not 0 <= v <= 255:
+                sys.exit("%s: %d n'est pas un octet (not a byte)" % (chemin, v))
+        return bytes(valeurs)
+    with open(chemin, "rb") as f:
+        return f.read()
+
+
+def construire(entrees):
+    """entrees: [(nom, octets)] -> (paquet, [(nom, brut, compressé)])"""
+    if len(entrees) > 255:
+        sys.exit("255 donnees maximum par paquet (255 entries max per pack)")
+    entete = 1 + 2 * len(entrees)
+    corps = bytearray()
+    debuts = []
+    stats = []
+    for nom, donnees in entrees:
+        if len(donnees) > 0xFFFF:
+            sys.exit("%s: 65535 octets maximum" % nom)
+        jetons = compresser(donnees)
+        if decompresser(jetons, len(donnees)) != donnees:
+            sys.exit("%s: erreur de compression (compression error)" % nom)
+        debuts.append(entete + len(corps))
+        corps += bytes([len(donnees) & 0xFF, len(donnees) >> 8]) + jetons
+        stats.append((nom, len(donnees), 2 + len(jetons)))
+    paquet = bytearray([len(entrees)])
+    for d in debuts:
+        if d > 0xFFFF:
+            sys.exit("paquet trop gros (pack too big)")
+        paquet += bytes([d & 0xFF, d >> 8])
+    return bytes(paquet + corps), stats
+
+
+def ecrire_entete(chemin, nom, paquet, stats):
+    garde = re.sub(r"\W", "_", os.path.basename(chemin)).upper()
+    lignes = [
+        "// ==========================================================",
+        "// %s - Paquet compressé (Compressed pack)" % os.path.basename(chemin).upper(),
+        "// ==========================================================",
+        "// Généré par tools/packer/packer.py - ne pas modifier!",
+        "// (Generated by tools/packer/packer.py - do not edit!)",
+        "// Lire avec pm_decompresser() ou pm_fluxLire() de ProgMem.h",
+        "// ==========================================================",
+        "",
+        "#ifndef %s" % garde,
+        "#define %s" % garde,
+        "",
+        '#include "ProgMem.h"',
+        "",
+    ]
+    brut = sum(s[1] for s in stats)
+    for i, (donnee, taille, compresse) in enumerate(stats):
+        lignes.append("#define %s_%s %d  // %d -> %d octets" % (nom.upper(), donnee.upper(), i, taille, compresse))
+    lignes.append("")
+    lignes.append("// %d octets bruts -> %d octets en Flash (%d raw bytes -> %d in Flash)"
+                  % (brut, len(paquet), brut, len(paquet)))
+    lignes.append("const uint8_t %s[] PROGMEM = {" % nom)
+    for i in range(0, len(paquet), 16):
+        lignes.append("  " + ", ".join("0x%02X" % b for b in paquet[i:i + 16]) + ",")
+    lignes.append("};")
+    lignes.append("")
+    lignes.append("#endif")
+    with open(chemin, "w", encoding="utf-8") as f:
+        f.write("\n".join(lignes) + "\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compresse des données pour ProgMem.h")
+    parser.add_argument("-o", "--sortie", required=True, help="Fichier .h à écrire")
+    parser.add_argument("-n", "--nom", required=True, help="Nom du tableau PROGMEM")
+    parser.add_argument("donnees", nargs="+", help="NOM=fichier")
+    args = parser.parse_args()
+
+    entrees = []
+    for argument in args.donnees:
+        if "=" not in argument:
+            sys.exit("%s: attendu NOM=fichier (expected NAME=file)" % argument)
+        nom, chemin = argument.split("=", 1)
+        entrees.append((nom, lire_fichier(chemin)))
+
+    paquet, stats = construire(entrees)
+    ecrire_entete(args.sortie, args.nom, paquet, stats)
+
+    brut = sum(s[1] for s in stats)
+    for nom, taille, compresse in stats:
+        print("  %-16s %6d -> %6d octets" % (nom, taille, compresse))
+    print("%s: %d -> %d octets (%d%%)" % (args.sortie, brut, len(paquet), 100 * len(paquet) // max(brut, 1)))
+
+
+if __name__ == "__main__":
+    main()
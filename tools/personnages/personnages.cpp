@@ -0,0 +1,222 @@
+// ==========================================================
+// PERSONNAGES.CPP - Pré-dessine les personnages en Flash
+// (Pre-draws the characters into Flash)
+// ==========================================================
+// Appelle les VRAIES fonctions de dessin de Personnages.h
+// (dessinerHerosPlateforme, dessinerPersonnageVueHaut...)
+// avec le remplaçant U8g2 de tools/host, qui dessine dans un
+// tampon de page comme l'écran. Chaque personnage x direction
+// x image de marche devient une image d'un sprite, écrite dans
+// Game/PersonnagesImages.h au format de Sprites.h.
+// (Calls the REAL drawing functions of Personnages.h with the
+// U8g2 stand-in from tools/host, which draws into a page
+// buffer like the screen. Each character x direction x walk
+// frame becomes one frame of a sprite, written to
+// Game/PersonnagesImages.h in the Sprites.h format.)
+//
+// Compilé avec -DPERS_SANS_IMAGES: Personnages.h n'inclut
+// pas le fichier qu'on est en train de fabriquer.
+// (Built with -DPERS_SANS_IMAGES so Personnages.h does not
+// include the file being made.)
+//
+// Usage:
+//   make assets
+//   build/personnages/personnages Game/PersonnagesImages.h
+// ==========================================================
+
+#include <Arduino.h>
+
+#include "Personnages.h"
+
+#include <string>
+#include <vector>
+
+// Le point (x, y) du dessin, loin des bords pour ne rien couper
+// (The drawing's point, far from the edges so nothing is clipped)
+#define ORIGINE_X 64
+#define ORIGINE_Y 32
+
+typedef void (*Dessin)(int numero, int image);
+
+struct Feuille {
+  std::string nom;
+  int largeur, hauteur, pages, images;
+  int decalX, decalY;
+  std::vector<uint8_t> octets;  // [image][page][colonne]
+};
+
+// ==========================================================
+// DESSIN (Drawing)
+// ==========================================================
+
+// Une image sur tout l'écran: 8 pages copiées (One frame, all 8 pages)
+void dessinerEcran(Dessin dessin, int numero, int image, uint8_t ecranComplet[8][LARGEUR_ECRAN]) {
+  DESSINER_ECRAN {
+    dessin(numero, image);
+    memcpy(ecranComplet[numeroPage()], tamponPage(), LARGEUR_ECRAN);
+  }
+}
+
+inline bool pixel(uint8_t ecranComplet[8][LARGEUR_ECRAN], int x, int y) {
+  return (ecranComplet[y >> 3][x] >> (y & 7)) & 1;
+}
+
+// Toutes les images d'un personnage dans UNE boîte commune
+// (All frames of a character inside ONE shared box)
+Feuille fabriquerFeuille(const char* nom, Dessin dessin, int numero, int images) {
+  std::vector<std::vector<uint8_t> > ecrans(images, std::vector<uint8_t>(8 * LARGEUR_ECRAN));
+  int xMin = LARGEUR_ECRAN, yMin = HAUTEUR_ECRAN, xMax = -1, yMax = -1;
+  for (int i = 0; i < images; i++) {
+    uint8_t (*e)[LARGEUR_ECRAN] = (uint8_t (*)[LARGEUR_ECRAN])ecrans[i].data();
+    dessinerEcran(dessin, numero, i, e);
+    for (int y = 0; y < HAUTEUR_ECRAN; y++) {
+      for (int x = 0; x < LARGEUR_ECRAN; x++) {
+        if (!pixel(e, x, y)) continue;
+        if (x < xMin) xMin = x;
+        if (x > xMax) xMax = x;
+        if (y < yMin) yMin = y;
+        if (y > yMax) yMax = y;
+      }
+    }
+  }
+  if (xMax < 0) {
+    fprintf(stderr, "%s: image vide (empty picture)\n", nom);
+    exit(1);
+  }
+  if (xMin == 0 || yMin == 0 || xMax == LARGEUR_ECRAN - 1 || yMax == HAUTEUR_ECRAN - 1) {
+    fprintf(stderr, "%s: dessin coupé par le bord (drawing clipped)\n", nom);
+    exit(1);
+  }
+
+  Feuille f;
+  f.nom = nom;
+  f.largeur = xMax - xMin + 1;
+  f.hauteur = yMax - yMin + 1;
+  f.pages = (f.hauteur + 7) / 8;
+  f.images = images;
+  f.decalX = xMin - ORIGINE_X;
+  f.decalY = yMin - ORIGINE_Y;
+  for (int i = 0; i < images; i++) {
+    uint8_t (*e)[LARGEUR_ECRAN] = (uint8_t (*)[LARGEUR_ECRAN])ecrans[i].data();
+    for (int p = 0; p < f.pages; p++) {
+      for (int x = 0; x < f.largeur; x++) {
+        uint8_t octet = 0;
+        for (int bit = 0; bit < 8; bit++) {
+          int y = yMin + p * 8 + bit;
+          if (y <= yMax && pixel(e, xMin + x, y)) octet |= 1 << bit;
+        }
+        f.octets.push_back(octet);
+      }
+    }
+  }
+  return f;
+}
+
+// Images vue plateforme: droite 0-1, gauche 2-3 (Platform frames)
+void dessinPlateforme(int numero, int image) {
+  pers_dessinerPlateformeFormes(ORIGINE_X, ORIGINE_Y, numero,
+                                image < 2 ? DIR_DROITE : DIR_GAUCHE, image & 1);
+}
+
+// Images vue de dessus: une par direction (Top-view frames: one per direction)
+void dessinVueHaut(int numero, int image) {
+  pers_dessinerVueHautFormes(ORIGINE_X, ORIGINE_Y, PERS_TAILLE_VUE_HAUT, numero, image);
+}
+
+// ==========================================================
+// ÉCRITURE (Writing)
+// ==========================================================
+
+static const char* pers_noms[NOMBRE_PERSONNAGES] = { "blob", "bonhomme", "heros", "champion" };
+
+// Écrit les sprites d'une vue, une feuille identique n'est écrite
+// qu'une fois (Writes one view's sprites - an identical sheet is
+// written only once)
+void ecrireVue(FILE* sortie, const char* vue, const char* table, const Feuille* feuilles) {
+  std::string noms[NOMBRE_PERSONNAGES];
+  for (int n = 0; n < NOMBRE_PERSONNAGES; n++) {
+    const Feuille& f = feuilles[n];
+    noms[n] = std::string("pers_") + vue + "_" + f.nom;
+    bool pareil = false;
+    for (int m = 0; m < n && !pareil; m++) {
+      if (feuilles[m].octets == f.octets && feuilles[m].largeur == f.largeur &&
+          feuilles[m].decalX == f.decalX && feuilles[m].decalY == f.decalY) {
+        fprintf(sortie, "// %s: comme %s (same as %s)\n\n", f.nom.c_str(), feuilles[m].nom.c_str(), feuilles[m].nom.c_str());
+        noms[n] = noms[m];
+        pareil = true;
+      }
+    }
+    if (pareil) continue;
+
+    fprintf(sortie, "// %s: %dx%d, %d image(s)\n", f.nom.c_str(), f.largeur, f.hauteur, f.images);
+    fprintf(sortie, "const uint8_t %s_dessin[] PROGMEM = {\n", noms[n].c_str());
+    for (size_t i = 0; i < f.octets.size(); i += f.largeur) {
+      fprintf(sortie, " ");
+      for (int k = 0; k < f.largeur; k++) fprintf(sortie, " 0x%02X,", f.octets[i + k]);
+      fprintf(sortie, "\n");
+    }
+    fprintf(sortie, "};\n");
+    fprintf(sortie, "const Sprite %s PROGMEM = { %s_dessin, nullptr, %d, %d, %d, %d };\n\n",
+            noms[n].c_str(), noms[n].c_str(), f.largeur, f.hauteur, f.pages, f.images);
+  }
+
+  fprintf(sortie, "const PersImage %s[NOMBRE_PERSONNAGES] PROGMEM = {\n", table);
+  for (int n = 0; n < NOMBRE_PERSONNAGES; n++) {
+    fprintf(sortie, "  { &%s, %d, %d },\n", noms[n].c_str(), feuilles[n].decalX, feuilles[n].decalY);
+  }
+  fprintf(sortie, "};\n\n");
+}
+
+// ==========================================================
+// PROGRAMME PRINCIPAL (Main program)
+// ==========================================================
+
+int main(int argc, char** argv) {
+  if (argc != 2) {
+    fprintf(stderr, "usage: %s Game/PersonnagesImages.h\n", argv[0]);
+    return 1;
+  }
+
+  Feuille plateforme[NOMBRE_PERSONNAGES];
+  Feuille vueHaut[NOMBRE_PERSONNAGES];
+  for (int n = 0; n < NOMBRE_PERSONNAGES; n++) {
+    bool blob = n == PERSO_BLOB;
+    plateforme[n] = fabriquerFeuille(pers_noms[n], dessinPlateforme, n, blob ? 1 : 4);
+    vueHaut[n] = fabriquerFeuille(pers_noms[n], dessinVueHaut, n, blob ? 1 : 4);
+  }
+
+  FILE* sortie = fopen(argv[1], "w");
+  if (!sortie) {
+    perror(argv[1]);
+    return 1;
+  }
+  fprintf(sortie,
+          "// ==========================================================\n"
+          "// PERSONNAGESIMAGES.H - Personnages pré-dessinés\n"
+          "// (Pre-drawn characters)\n"
+          "// ==========================================================\n"
+          "// Généré par tools/personnages/personnages.cpp depuis les\n"
+          "// formes de Personnages.h (make assets) - ne pas modifier!\n"
+          "// (Generated from the shapes in Personnages.h - do not edit!)\n"
+          "// ==========================================================\n"
+          "\n"
+          "#ifndef PERSONNAGESIMAGES_H\n"
+          "#define PERSONNAGESIMAGES_H\n"
+          "\n"
+          "// Inclus par Personnages.h (Included by Personnages.h)\n"
+          "\n");
+  fprintf(sortie, "// ----------------------------------------------------------\n"
+                  "// Vue plateforme (Platform view)\n"
+                  "// ----------------------------------------------------------\n\n");
+  ecrireVue(sortie, "plateforme", "pers_imagesPlateforme", plateforme);
+  fprintf(sortie, "// ----------------------------------------------------------\n"
+                  "// Vue de dessus, taille %d (Top view, size %d)\n"
+                  "// ----------------------------------------------------------\n\n",
+          PERS_TAILLE_VUE_HAUT, PERS_TAILLE_VUE_HAUT);
+  ecrireVue(sortie, "vueHaut", "pers_imagesVueHaut", vueHaut);
+  fprintf(sortie, "#endif\n");
+  fclose(sortie);
+
+  printf("%s: ok\n", argv[1]);
+  return 0;
+}
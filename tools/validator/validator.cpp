@@ -0,0 +1,457 @@
+// ==========================================================
+// VALIDATOR.CPP - Vérifie que les niveaux d'Aventurier
+// sont gagnables (Checks that Aventurier levels can be won)
+// ==========================================================
+// Pour chaque niveau, on rejoue la VRAIE physique du jeu
+// (av_pasControles + av_pasPhysique d'Aventurier.h) avec
+// toutes les actions possibles à chaque image: gauche,
+// rien, droite, avec ou sans saut. C'est une recherche en
+// largeur sur l'état (x, y, vitesseY, auSol) du joueur.
+// (For each level, the REAL game physics is replayed with
+// every possible input on every frame. It's a breadth-first
+// search over the player state (x, y, vy, onGround).)
+//
+// Niveaux 1-5: un seul écran, du départ à la porte.
+// Niveaux 6+: le monde est vérifié morceau par morceau. On
+// part de toutes les façons d'atterrir sur le morceau c et
+// on cherche toutes les façons d'atterrir sur c+1 - comme
+// l'anneau du jeu, la mémoire ne dépend pas de la longueur.
+// (Levels 1-5: one screen, from start to door.
+// Levels 6+: the world is checked chunk by chunk. Starting
+// from every way of landing on chunk c, we find every way of
+// landing on c+1 - like the game's ring, memory does not
+// depend on the length.)
+//
+// Pas de statistiques d'essais: ProcMonde n'a pas de
+// nouvel essai, chaque morceau coûte toujours 3 tirages.
+// (No try statistics: ProcMonde never retries, every chunk
+// always costs 3 draws.)
+//
+// Résultat: la liste des niveaux IMPOSSIBLES et où ils
+// bloquent. (Output: the list of UNWINNABLE levels and where
+// they get stuck.)
+//
+// Usage:
+//   make validate                          (niveaux 1 à 2000)
+//   build/validator/validator 1 32767      (tous les niveaux possibles)
+//   build/validator/validator 1 1000 4     (4 threads)
+//   build/validator/validator -v 12        (détail du niveau 12)
+// ==========================================================
+
+#include <Arduino.h>
+
+#include "Aventurier.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+// ==========================================================
+// ÉTATS DU JOUEUR (Player states)
+// ==========================================================
+// x: -16..127, y: -32..95, vy: -5..4, auSol: 0/1
+
+#define VAL_X_DECALAGE 16
+#define VAL_NB_X 144
+#define VAL_Y_DECALAGE 32
+#define VAL_NB_Y 128
+#define VAL_NB_VY (AV_FORCE_SAUT + AV_VITESSE_CHUTE_MAX + 1)
+#define VAL_NB_ETATS (VAL_NB_X * VAL_NB_Y * VAL_NB_VY * 2)
+
+#define VAL_NIVEAU_MAX 32767  // int 16 bits sur Arduino (16-bit int on Arduino)
+
+inline int val_coder(int x, int y, int vy, bool auSol) {
+  return (((x + VAL_X_DECALAGE) * VAL_NB_Y + (y + VAL_Y_DECALAGE)) * VAL_NB_VY + (vy + AV_FORCE_SAUT)) * 2 +
+         (auSol ? 1 : 0);
+}
+
+inline void val_decoder(int code, int* x, int* y, int* vy, bool* auSol) {
+  *auSol = code & 1;
+  code >>= 1;
+  *vy = code % VAL_NB_VY - AV_FORCE_SAUT;
+  code /= VAL_NB_VY;
+  *y = code % VAL_NB_Y - VAL_Y_DECALAGE;
+  *x = code / VAL_NB_Y - VAL_X_DECALAGE;
+}
+
+// Mémoire de recherche d'un thread (Per-thread search memory)
+// "vu" garde le numéro de la recherche: pas besoin d'effacer.
+// ("vu" stores the search number: no need to clear it.)
+struct ValRecherche {
+  std::vector<uint32_t> vu;
+  std::vector<uint8_t> origine;  // Dernière plateforme touchée (Last platform stood on)
+  std::vector<int> file;
+  std::vector<int> departs;      // Atterrissages sur le morceau suivant (Landings on the next chunk)
+  uint32_t numero = 0;
+
+  ValRecherche() : vu(VAL_NB_ETATS, 0), origine(VAL_NB_ETATS, 0), file(VAL_NB_ETATS) { }
+};
+
+// Ce qu'une recherche voit (What one search sees)
+struct ValZone {
+  PmArray<PmPlateforme> fixes;         // Niveaux 1-5 (Levels 1-5)
+  ObjetSimple plat[AV_MAX_PLATEFORMES];
+  uint8_t morceaux[AV_MAX_PLATEFORMES];
+  CarteCollision carte;                // Refaite quand les cases changent (Rebuilt when slots change)
+  int xMin, xMax;
+  bool avecPorte;
+  int porteX, porteY;
+  int cible;           // Case dont on garde les atterrissages, ou -1 (Slot whose landings are kept)
+  bool retourDepart;   // Tomber = revenir au départ (niveaux 1-5) (Falling = back to start)
+};
+
+// Résultat pour un niveau (Result for one level)
+struct ValResultat {
+  int niveau;
+  bool gagnable;
+  long etats;                             // États visités (States visited)
+  uint8_t atteintes;                      // Niveaux 1-5: bit i = plateforme i atteinte
+  int8_t parent[AV_MAX_PLATEFORMES];      // Graphe: d'où on arrive (Where we came from)
+  int8_t dernierePlateforme;              // Plateforme avant la porte (Platform before door)
+  int nbMorceaux;                         // Niveaux 6+: 0 pour 1-5
+  int bloque;                             // Premier morceau jamais atteint, ou -1
+};
+
+// ==========================================================
+// RECHERCHE (Search)
+// ==========================================================
+
+// Recherche en largeur à partir des états déjà dans la file.
+// complet = false: on s'arrête dès que la porte est touchée.
+// (BFS from the states already queued. complete = false: stop
+// as soon as the door is touched.)
+long val_chercher(ValRecherche& r, ValZone& z, int fin, ValResultat& res, bool complet) {
+  int debut = 0;
+  r.departs.clear();
+
+  while (debut < fin) {
+    int code = r.file[debut++];
+    int x0, y0, vy0;
+    bool auSol0;
+    val_decoder(code, &x0, &y0, &vy0, &auSol0);
+    uint8_t origine = r.origine[code];
+
+    for (int dx = -1; dx <= 1; dx++) {
+      for (int saut = 0; saut <= (auSol0 ? 1 : 0); saut++) {
+        int x = x0, y = y0, vy = vy0;
+        av_pasControles(&x, &vy, dx, saut == 1, z.xMin, z.xMax);
+        int sol = av_pasPhysique(&x, &y, &vy, z.fixes, z.plat, z.morceaux, &z.carte);
+
+        if (sol == AV_TOMBE) {
+          if (!z.retourDepart) continue;
+          x = AV_DEPART_X;
+          y = AV_DEPART_Y;
+          vy = 0;
+          sol = -1;
+        }
+
+        uint8_t nouvelleOrigine = origine;
+        if (sol >= 0) {
+          if (!(res.atteintes & (1 << sol))) {
+            res.atteintes |= 1 << sol;
+            if (sol != origine) res.parent[sol] = origine;
+          }
+          nouvelleOrigine = sol;
+        }
+
+        if (z.avecPorte && av_toucheAPorte(x, y, z.porteX, z.porteY) && !res.gagnable) {
+          res.gagnable = true;
+          res.dernierePlateforme = nouvelleOrigine;
+          if (!complet) return fin;
+        }
+
+        if (y < -VAL_Y_DECALAGE || y >= VAL_NB_Y - VAL_Y_DECALAGE) continue;
+        int suivant = val_coder(x, y, vy, sol >= 0);
+        if (r.vu[suivant] != r.numero) {
+          r.vu[suivant] = r.numero;
+          r.origine[suivant] = nouvelleOrigine;
+          r.file[fin++] = suivant;
+          if (sol >= 0 && sol == z.cible) {
+            r.departs.push_back(val_coder(x - PROC_MORCEAU_LARGEUR, y, vy, true));
+          }
+        }
+      }
+    }
+  }
+  return fin;
+}
+
+// Mettre un état de départ dans la file (Queue a start state)
+inline int val_ajouterDepart(ValRecherche& r, int code, uint8_t origine, int fin) {
+  if (r.vu[code] == r.numero) return fin;
+  r.vu[code] = r.numero;
+  r.origine[code] = origine;
+  r.file[fin++] = code;
+  return fin;
+}
+
+// Niveaux 1-5: tout l'écran d'un coup (Levels 1-5: the whole screen at once)
+void val_verifierFixe(int niveau, ValRecherche& r, ValResultat& res, bool complet) {
+  ValZone z;
+  for (int i = 0; i < AV_MAX_PLATEFORMES; i++) {
+    z.plat[i].actif = false;
+    z.morceaux[i] = 0;
+  }
+  av_chargerNiveauFixe(niveau, &z.fixes, &z.porteX, &z.porteY);
+  av_construireCarte(&z.carte, z.fixes, z.plat, z.morceaux);
+  z.xMin = 5;
+  z.xMax = PROC_ECRAN_LARGEUR - 5;
+  z.avecPorte = true;
+  z.cible = -1;
+  z.retourDepart = true;
+
+  r.numero++;
+  int fin = val_ajouterDepart(r, val_coder(AV_DEPART_X, AV_DEPART_Y, 0, true), 0, 0);
+  res.etats = val_chercher(r, z, fin, res, complet);
+}
+
+// Niveaux 6+: morceau par morceau (Levels 6+: chunk by chunk)
+// La recherche pour le morceau c voit c (case 0) et c+1
+// (case 1), en coordonnées relatives au morceau c.
+// (The search for chunk c sees c (slot 0) and c+1 (slot 1),
+// in coordinates relative to chunk c.)
+void val_verifierMonde(int niveau, ValRecherche& r, ValResultat& res, bool complet) {
+  ProcMonde monde;
+  int nbMorceaux = proc_mondeNbMorceaux(niveau);
+  int largeurMonde = (nbMorceaux + 1) << PROC_MORCEAU_BITS;
+  proc_mondeDebut(&monde, niveau, nbMorceaux, proc_calculerDifficulte(niveau));
+  res.nbMorceaux = nbMorceaux;
+
+  ValZone z;
+  for (int i = 0; i < AV_MAX_PLATEFORMES; i++) {
+    z.plat[i].actif = false;
+    z.morceaux[i] = 0;
+  }
+  z.fixes.taille = 0;
+  z.morceaux[1] = 1;
+  z.xMin = -VAL_X_DECALAGE;
+  z.cible = 1;
+  z.retourDepart = false;
+
+  // Morceau 0 (Chunk 0)
+  proc_mondePas(&monde);
+  z.plat[1].x = monde.x;
+  z.plat[1].y = monde.y;
+  z.plat[1].largeur = monde.largeur;
+  z.plat[1].type = 1;
+  z.plat[1].actif = true;
+
+  std::vector<int> departs;
+  departs.push_back(val_coder(AV_DEPART_X, AV_DEPART_Y, 0, true));
+  res.etats = 0;
+
+  for (int c = 0; c < nbMorceaux - 1; c++) {
+    // Le morceau c+1 devient la case 1 (Chunk c+1 becomes slot 1)
+    z.plat[0] = z.plat[1];
+    proc_mondePas(&monde);
+    z.plat[1].x = monde.x;
+    z.plat[1].y = monde.y;
+    z.plat[1].largeur = monde.largeur;
+    av_construireCarte(&z.carte, z.fixes, z.plat, z.morceaux);
+
+    int debutMorceau = c << PROC_MORCEAU_BITS;
+    z.xMax = std::min(largeurMonde - 5 - debutMorceau, VAL_NB_X - VAL_X_DECALAGE - 1);
+    z.avecPorte = proc_mondeTermine(&monde);
+    if (z.avecPorte) {
+      proc_mondePorte(&monde, &z.porteX, &z.porteY);
+      z.porteX -= debutMorceau;
+    }
+
+    r.numero++;
+    int fin = 0;
+    for (int code : departs) fin = val_ajouterDepart(r, code, 0, fin);
+    res.atteintes = 0;
+    res.etats += val_chercher(r, z, fin, res, complet && !z.avecPorte);
+
+    if (!(res.atteintes & 2)) {
+      res.bloque = c + 1;
+      return;
+    }
+    departs.swap(r.departs);
+  }
+}
+
+// complet = false: on s'arrête dès que la porte est touchée
+// (complete = false: stop as soon as the door is touched)
+ValResultat val_verifier(int niveau, ValRecherche& r, bool complet = false) {
+  ValResultat res;
+  res.niveau = niveau;
+  res.gagnable = false;
+  res.etats = 0;
+  res.atteintes = 0;
+  res.dernierePlateforme = -1;
+  res.nbMorceaux = 0;
+  res.bloque = -1;
+  for (int i = 0; i < AV_MAX_PLATEFORMES; i++) res.parent[i] = -1;
+
+  if (niveau <= 5) {
+    val_verifierFixe(niveau, r, res, complet);
+  } else {
+    val_verifierMonde(niveau, r, res, complet);
+  }
+  return res;
+}
+
+// ==========================================================
+// AFFICHAGE (Output)
+// ==========================================================
+
+void val_afficherImpossible(const ValResultat& res) {
+  if (res.nbMorceaux == 0) {
+    printf("%6d   plateformes ", res.niveau);
+    for (int i = 0; i < 5; i++) {
+      printf("%c", (res.atteintes & (1 << i)) ? '0' + i : '.');
+    }
+  } else if (res.bloque >= 0) {
+    printf("%6d   bloque au morceau %d/%d", res.niveau, res.bloque, res.nbMorceaux);
+  } else {
+    printf("%6d   porte jamais touchee", res.niveau);
+  }
+  printf("\n");
+}
+
+void val_afficherDetail(int niveau) {
+  ValRecherche r;
+  ValResultat res = val_verifier(niveau, r, true);
+
+  printf("Niveau %d (difficulte %d)\n", niveau, proc_calculerDifficulte(niveau));
+
+  if (niveau <= 5) {
+    PmArray<PmPlateforme> plat;
+    int porteX, porteY;
+    av_chargerNiveauFixe(niveau, &plat, &porteX, &porteY);
+    for (int i = 0; i < plat.taille; i++) {
+      PmPlateforme p = plat[i];
+      printf("  plateforme %d: x=%3d y=%2d largeur=%2d  %s", i, p.x, p.y, p.largeur,
+             (res.atteintes & (1 << i)) ? "atteinte" : "JAMAIS");
+      if (res.parent[i] >= 0) printf(" (depuis %d)", res.parent[i]);
+      printf("\n");
+    }
+    printf("  porte: x=%d y=%d\n", porteX, porteY);
+  } else {
+    ProcMonde monde;
+    proc_mondeDebut(&monde, niveau, res.nbMorceaux, proc_calculerDifficulte(niveau));
+    printf("  %d morceaux (%d ecrans)\n", res.nbMorceaux, res.nbMorceaux / 4);
+    for (int c = 0; proc_mondePas(&monde); c++) {
+      bool atteint = (res.bloque < 0 || c < res.bloque);
+      printf("  morceau %2d: x=%4d y=%2d largeur=%2d  %s\n", c, (c << PROC_MORCEAU_BITS) + monde.x, monde.y,
+             monde.largeur, atteint ? "atteint" : "JAMAIS");
+    }
+    int porteX, porteY;
+    proc_mondePorte(&monde, &porteX, &porteY);
+    printf("  porte: x=%d y=%d\n", porteX, porteY);
+  }
+
+  if (res.gagnable) {
+    if (niveau <= 5) {
+      // Remonter le graphe depuis la porte (Walk the graph back from the door)
+      printf("  GAGNABLE: porte <- %d", res.dernierePlateforme);
+      int p = res.dernierePlateforme;
+      while (p > 0 && res.parent[p] >= 0) {
+        p = res.parent[p];
+        printf(" <- %d", p);
+      }
+    } else {
+      printf("  GAGNABLE");
+    }
+    printf("  (%ld etats)\n", res.etats);
+  } else {
+    printf("  IMPOSSIBLE (%ld etats)\n", res.etats);
+  }
+}
+
+// ==========================================================
+// PROGRAMME PRINCIPAL (Main program)
+// ==========================================================
+
+struct ValStats {
+  long niveaux = 0;
+  long gagnables = 0;
+  long morceaux = 0;                 // Morceaux vérifiés (Chunks checked)
+  long etats = 0;
+  std::vector<ValResultat> impossibles;
+};
+
+int main(int argc, char** argv) {
+  if (argc >= 3 && strcmp(argv[1], "-v") == 0) {
+    val_afficherDetail(atoi(argv[2]));
+    return 0;
+  }
+
+  int premier = (argc >= 2) ? atoi(argv[1]) : 1;
+  int dernier = (argc >= 3) ? atoi(argv[2]) : VAL_NIVEAU_MAX;
+  if (premier < 1 || dernier > VAL_NIVEAU_MAX || premier > dernier) {
+    fprintf(stderr, "Niveaux entre 1 et %d seulement (le niveau est un int 16 bits sur Arduino)\n", VAL_NIVEAU_MAX);
+    return 2;
+  }
+  int nbThreads = (argc >= 4) ? atoi(argv[3]) : (int)std::thread::hardware_concurrency();
+  if (nbThreads < 1) nbThreads = 1;
+
+  printf("Validation des niveaux %d a %d avec %d threads...\n", premier, dernier, nbThreads);
+  auto debut = std::chrono::steady_clock::now();
+
+  std::atomic<int> prochain(premier);
+  std::vector<ValStats> stats(nbThreads);
+  std::vector<std::thread> threads;
+
+  for (int t = 0; t < nbThreads; t++) {
+    threads.emplace_back([&, t]() {
+      ValRecherche r;
+      ValStats& s = stats[t];
+      const int paquet = 64;
+      for (;;) {
+        int a = prochain.fetch_add(paquet);
+        if (a > dernier) break;
+        int b = std::min(dernier, a + paquet - 1);
+        for (int niveau = a; niveau <= b; niveau++) {
+          ValResultat res = val_verifier(niveau, r);
+          s.niveaux++;
+          s.morceaux += res.nbMorceaux;
+          s.etats += res.etats;
+          if (res.gagnable) {
+            s.gagnables++;
+          } else {
+            s.impossibles.push_back(res);
+          }
+        }
+      }
+    });
+  }
+  for (auto& th : threads) th.join();
+
+  // Fusionner (Merge)
+  ValStats total;
+  for (auto& s : stats) {
+    total.niveaux += s.niveaux;
+    total.gagnables += s.gagnables;
+    total.morceaux += s.morceaux;
+    total.etats += s.etats;
+    total.impossibles.insert(total.impossibles.end(), s.impossibles.begin(), s.impossibles.end());
+  }
+  std::sort(total.impossibles.begin(), total.impossibles.end(),
+            [](const ValResultat& a, const ValResultat& b) { return a.niveau < b.niveau; });
+
+  double secondes = std::chrono::duration<double>(std::chrono::steady_clock::now() - debut).count();
+
+  printf("\n== Resultat ==\n");
+  printf("niveaux:     %ld (%.0f niveaux/s)\n", total.niveaux, total.niveaux / secondes);
+  printf("morceaux:    %ld (%.1f par niveau)\n", total.morceaux,
+         total.niveaux > 0 ? (double)total.morceaux / total.niveaux : 0.0);
+  printf("etats:       %ld\n", total.etats);
+  printf("gagnables:   %ld\n", total.gagnables);
+  printf("IMPOSSIBLES: %zu\n", total.impossibles.size());
+
+  size_t affiches = std::min<size_t>(total.impossibles.size(), 50);
+  if (affiches > 0) {
+    printf("\nniveau   probleme\n");
+    for (size_t i = 0; i < affiches; i++) val_afficherImpossible(total.impossibles[i]);
+    if (affiches < total.impossibles.size()) {
+      printf("... et %zu autres\n", total.impossibles.size() - affiches);
+    }
+    printf("(detail: validator -v <niveau>)\n");
+  }
+
+  return total.impossibles.empty() ? 0 : 1;
+}